@@ -0,0 +1,118 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include "adaptive-sweep.hpp"
+
+std::vector<Sample> adaptive_sweep(std::size_t min_size, std::size_t max_size,
+      const std::function<double(std::size_t)>& measure,
+      double threshold, double resolution, std::size_t max_samples) {
+   std::map<std::size_t, double> samples;
+   for (std::size_t size = min_size; size < max_size; size *= 2) {
+      samples[size] = measure(size);
+   }
+   samples[max_size] = measure(max_size);
+
+   bool bisected;
+   do {
+      bisected = false;
+      auto it = samples.begin();
+      auto prev = it++;
+      for (; it != samples.end() && samples.size() < max_samples;
+	    prev = it++) {
+	 std::size_t a = prev->first; std::size_t b = it->first;
+	 double ta = prev->second; double tb = it->second;
+	 if (std::fabs(tb - ta) <= threshold * std::min(ta, tb)) continue;
+	 if (b <= a * (1 + resolution)) continue;
+	 /* keep sizes aligned to 1 KiB as long as possible */
+	 std::size_t align = b - a >= 4096? 1024: sizeof(void*);
+	 std::size_t mid = static_cast<std::size_t>(
+	    std::sqrt(static_cast<double>(a) * b)) / align * align;
+	 if (mid <= a || mid >= b) continue;
+	 samples[mid] = measure(mid);
+	 bisected = true;
+      }
+   } while (bisected && samples.size() < max_samples);
+
+   std::vector<Sample> result;
+   for (auto& sample: samples) {
+      result.push_back(Sample{sample.first, sample.second});
+   }
+   return result;
+}
+
+/* return the median of the given values */
+static double median(std::vector<double> values) {
+   std::sort(values.begin(), values.end());
+   return values[values.size() / 2];
+}
+
+std::vector<Level> detect_levels(const std::vector<Sample>& samples,
+      double tolerance, double min_span, double min_step) {
+   std::size_t n = samples.size();
+   /* filter isolated outliers */
+   std::vector<double> smoothed(n);
+   for (std::size_t i = 0; i < n; ++i) {
+      if (i == 0 || i + 1 == n) {
+	 smoothed[i] = samples[i].ns;
+      } else {
+	 smoothed[i] = median({samples[i-1].ns, samples[i].ns,
+	    samples[i+1].ns});
+      }
+   }
+
+   std::vector<Level> levels;
+   std::size_t i = 0;
+   while (i < n) {
+      double ref = smoothed[i];
+      std::size_t j = i + 1;
+      while (j < n && std::fabs(smoothed[j] - ref) <= tolerance * ref) {
+	 ++j;
+      }
+      if (samples[j-1].size >= samples[i].size * min_span) {
+	 double ns = median(std::vector<double>(smoothed.begin() + i,
+	    smoothed.begin() + j));
+	 if (!levels.empty() && ns < levels.back().ns * min_step) {
+	    levels.back().last = samples[j-1].size;
+	 } else {
+	    levels.push_back(Level{samples[i].size, samples[j-1].size, ns});
+	 }
+      }
+      i = j;
+   }
+   return levels;
+}
+
+std::size_t cache_levels(const std::vector<Level>& levels,
+      std::size_t llc_size) {
+   if (llc_size == 0) return levels.size();
+   std::size_t count = 0;
+   while (count < levels.size() && levels[count].first <= llc_size) {
+      ++count;
+   }
+   return count;
+}
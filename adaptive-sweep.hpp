@@ -0,0 +1,73 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef ADAPTIVE_SWEEP_HPP
+#define ADAPTIVE_SWEEP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/* measured access time for a buffer size */
+struct Sample {
+   std::size_t size;
+   double ns;
+};
+
+/* plateau of access times, i.e. a cache level or main memory,
+   from the smallest to the largest buffer size on it */
+struct Level {
+   std::size_t first;
+   std::size_t last;
+   double ns;
+};
+
+/* measure the access times for all powers of two between
+   min_size and max_size and bisect, in a geometric sense, each
+   interval whose access times differ by more than the given
+   relative threshold until the sizes are less than the given
+   relative resolution apart or max_samples is reached;
+   the samples are returned in the order of ascending sizes */
+std::vector<Sample> adaptive_sweep(std::size_t min_size, std::size_t max_size,
+   const std::function<double(std::size_t)>& measure,
+   double threshold, double resolution, std::size_t max_samples);
+
+/* detect the plateaus within the given ordered samples where the
+   access times, smoothed by a median of three, stay within the given
+   relative tolerance over sizes that span at least a factor of
+   min_span; plateaus whose access times are less than a factor of
+   min_step apart are merged; samples between plateaus are considered
+   to be transitions and do not belong to any level */
+std::vector<Level> detect_levels(const std::vector<Sample>& samples,
+   double tolerance, double min_span, double min_step);
+
+/* return the number of leading levels that are caches, i.e. that
+   begin within the last level cache of the given size while the
+   following levels are main memory; if the size of the last level
+   cache is not known (0), all levels are considered to be caches */
+std::size_t cache_levels(const std::vector<Level>& levels,
+   std::size_t llc_size);
+
+#endif
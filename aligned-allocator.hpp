@@ -0,0 +1,70 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/* allocator for standard containers that takes each allocation
+   from the heap by posix_memalign(3) with the alignment of T;
+   std::allocator ignores extended alignments before C++17 */
+template<typename T>
+class AlignedAllocator {
+   public:
+      using value_type = T;
+
+      AlignedAllocator() {
+      }
+      template<typename U>
+      AlignedAllocator(const AlignedAllocator<U>&) {
+      }
+
+      T* allocate(std::size_t n) {
+	 std::size_t alignment = alignof(T) < sizeof(void*)?
+	    sizeof(void*): alignof(T);
+	 void* p;
+	 if (posix_memalign(&p, alignment, n * sizeof(T))) {
+	    throw std::bad_alloc();
+	 }
+	 return (T*) p;
+      }
+      void deallocate(T* p, std::size_t) {
+	 std::free(p);
+      }
+
+      template<typename U>
+      bool operator==(const AlignedAllocator<U>&) const {
+	 return true;
+      }
+      template<typename U>
+      bool operator!=(const AlignedAllocator<U>&) const {
+	 return false;
+      }
+};
+
+#endif
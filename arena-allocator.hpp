@@ -0,0 +1,66 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef ARENA_ALLOCATOR_HPP
+#define ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include "memory-arena.hpp"
+
+/* allocator for standard containers that places all nodes
+   contiguously into a memory arena; deallocations are ignored,
+   the memory is released by resetting the arena */
+template<typename T>
+class ArenaAllocator {
+   public:
+      using value_type = T;
+
+      ArenaAllocator(MemoryArena& arena) : arena(&arena) {
+      }
+      template<typename U>
+      ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {
+      }
+
+      T* allocate(std::size_t n) {
+	 return (T*) arena->allocate(n * sizeof(T), alignof(T));
+      }
+      void deallocate(T*, std::size_t) {
+      }
+
+      template<typename U>
+      bool operator==(const ArenaAllocator<U>& other) const {
+	 return arena == other.arena;
+      }
+      template<typename U>
+      bool operator!=(const ArenaAllocator<U>& other) const {
+	 return arena != other.arena;
+      }
+
+   private:
+      template<typename U> friend class ArenaAllocator;
+      MemoryArena* arena;
+};
+
+#endif
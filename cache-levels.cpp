@@ -0,0 +1,157 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that detects the capacities and access times of all
+   cache levels and main memory using an adaptive sweep which
+   samples coarsely and bisects only where the access times change */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "cpu-topology.hpp"
+#include "memory-arena.hpp"
+#include "random-chain.hpp"
+#include "walltime.hpp"
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+/* 0 selects four times the capacity of the last level cache,
+   rounded up to a power of two, or 128 MiB if it is not known */
+#ifndef MAX_SIZE
+#define MAX_SIZE 0
+#endif
+/* backing of the chains, see memory-backing.hpp; transparent
+   huge pages keep TLB misses from blurring the plateaus of
+   the caches; the heap is taken if it is not available */
+#ifndef BACKING
+#define BACKING "thp"
+#endif
+/* number of pointers to be chased for each sample */
+#ifndef COUNT
+#define COUNT (std::size_t{1}<<22)
+#endif
+/* relative difference of access times that causes a bisection */
+#ifndef THRESHOLD
+#define THRESHOLD 0.1
+#endif
+/* minimal relative distance of neighbouring sizes */
+#ifndef RESOLUTION
+#define RESOLUTION 0.05
+#endif
+/* relative tolerance of access times on the same plateau */
+#ifndef TOLERANCE
+#define TOLERANCE 0.15
+#endif
+/* minimal factor between the smallest and the largest size
+   of a plateau */
+#ifndef MIN_SPAN
+#define MIN_SPAN 1.5
+#endif
+/* minimal factor between the access times of subsequent levels */
+#ifndef MIN_STEP
+#define MIN_STEP 1.5
+#endif
+#ifndef MAX_SAMPLES
+#define MAX_SAMPLES 128
+#endif
+
+/* included after the macros above as MAX_SAMPLES limits
+   the samples of the sweep here and not those of a measurement */
+#include "utility-config.hpp"
+
+int main() {
+   WallTime<double> walltime;
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKING, backings) || backings.size() != 1) {
+      std::cerr << "invalid backing: " << BACKING << std::endl;
+      std::exit(1);
+   }
+   std::size_t llc_size = last_level_cache_size();
+   std::size_t max_size = MAX_SIZE;
+   if (max_size == 0) {
+      max_size = std::size_t{128}<<20;
+      if (llc_size > 0) {
+	 max_size = MIN_SIZE;
+	 while (max_size < 4 * llc_size) max_size *= 2;
+      }
+   }
+
+   /* all chains are placed into one arena whose pages
+      are faulted in once for all samples */
+   std::unique_ptr<MemoryArena> arena(new MemoryArena(max_size,
+      backings[0], LOCK_MEMORY));
+   if (!arena->available()) {
+      std::cerr << "backing " << BACKING <<
+	 " is not available, using heap" << std::endl;
+      arena.reset(new MemoryArena(max_size, Backing::heap, LOCK_MEMORY));
+   }
+   if (LOCK_MEMORY && !arena->locked()) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+   void** memory = arena->memory();
+
+   auto measure = [=](std::size_t memsize) {
+      init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+      std::size_t count = COUNT;
+      /* warm up with one round, limited to count, unless the chain
+	 is far beyond the last level cache where this is pointless */
+      if (llc_size == 0 || memsize <= 2 * llc_size) {
+	 chase_pointers(memory, std::min(memsize / sizeof(void*), count));
+      }
+      double t = chase_pointers(memory, count);
+      return t * 1000000000 / count;
+   };
+   auto samples = adaptive_sweep(MIN_SIZE, max_size, measure,
+      THRESHOLD, RESOLUTION, MAX_SAMPLES);
+   auto levels = detect_levels(samples, TOLERANCE, MIN_SPAN, MIN_STEP);
+   std::size_t caches = cache_levels(levels, llc_size);
+
+   fmt::printf("       memsize  time in ns\n");
+   for (auto& sample: samples) {
+      fmt::printf(" %13u  %10.5lf\n", sample.size, sample.ns);
+   }
+   fmt::printf("\n");
+   if (levels.empty()) {
+      fmt::printf("# no levels detected\n");
+   } else {
+      fmt::printf("    level        capacity  time in ns\n");
+   }
+   for (std::size_t i = 0; i < levels.size(); ++i) {
+      if (i < caches) {
+	 fmt::printf("       L%u  %14u  %10.5lf\n",
+	    i + 1, levels[i].last, levels[i].ns);
+      } else {
+	 fmt::printf("     DRAM  %14s  %10.5lf\n", "-", levels[i].ns);
+      }
+   }
+   fmt::printf("\n# %u samples in %.2lf seconds\n",
+      samples.size(), walltime.elapsed());
+}
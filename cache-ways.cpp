@@ -0,0 +1,231 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that probes the associativity, the line size, and the
+   number of sets of all cache levels by chasing n cache lines that
+   are 2^k bytes apart: as soon as stride is a multiple of the
+   number of sets times the line size of a level, all lines are
+   mapped to the same set and the access times jump as soon
+   as n exceeds the number of ways of this level */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+#include "strided-chain.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+/* range of the power-of-two strides in bytes */
+#ifndef MIN_STRIDE
+#define MIN_STRIDE 512
+#endif
+#ifndef MAX_STRIDE
+#define MAX_STRIDE (std::size_t{1}<<20)
+#endif
+/* maximal number of lines that are mapped to the same set */
+#ifndef MAX_WAYS
+#define MAX_WAYS 32
+#endif
+/* backing of the buffers; huge pages keep physically indexed caches
+   from seeing random set indices and reduce TLB conflicts */
+#ifndef BACKING
+#define BACKING "thp"
+#endif
+/* size of the buffer for the line size and the DRAM access time
+   which should be much larger than the last level cache */
+#ifndef MEMSIZE
+#define MEMSIZE (std::size_t{1}<<28)
+#endif
+/* number of pointers to be chased for each measurement */
+#ifndef COUNT
+#define COUNT (std::size_t{1}<<20)
+#endif
+/* relative tolerance of access times on the same plateau */
+#ifndef TOLERANCE
+#define TOLERANCE 0.1
+#endif
+/* minimal factor between the smallest and the largest number
+   of lines of a plateau */
+#ifndef MIN_SPAN
+#define MIN_SPAN 1.2
+#endif
+/* minimal factor between the access times of subsequent levels */
+#ifndef MIN_STEP
+#define MIN_STEP 1.3
+#endif
+/* plateaus whose access times reach this fraction of
+   the access time of main memory are taken as main memory */
+#ifndef DRAM_FRACTION
+#define DRAM_FRACTION 0.75
+#endif
+
+/* chase the chain after a warm-up and return
+   the average access time in ns */
+double measure_chain(void** memory) {
+   std::size_t count = COUNT;
+   chase_pointers(memory, count / 16);
+   double t = chase_pointers(memory, count);
+   return t * 1000000000 / count;
+}
+
+/* return the largest number of lines n such that the access times
+   for 1 to n lines, smoothed by a median of three, stay below
+   the given threshold */
+std::size_t capacity(const std::vector<Sample>& samples, double threshold) {
+   std::size_t n = samples.size();
+   for (std::size_t i = 0; i < n; ++i) {
+      double ns = samples[i].ns;
+      if (i > 0 && i + 1 < n) {
+	 double a = samples[i-1].ns, b = samples[i+1].ns;
+	 ns = std::max(std::min(a, b), std::min(std::max(a, b), ns));
+      }
+      if (ns >= threshold) return i;
+   }
+   return n;
+}
+
+int main() {
+   WallTime<double> walltime;
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKING, backings) || backings.size() != 1) {
+      std::cerr << "invalid backing: " << BACKING << std::endl;
+      std::exit(1);
+   }
+   Backing backing = backings.front();
+   auto unavailable = [=]() {
+      std::cerr << "backing " << BACKING << " is not available" << std::endl;
+      std::exit(1);
+   };
+
+   /* main memory as reference */
+   void** memory = create_random_chain(MEMSIZE, backing, SEED, CHAIN_THREADS);
+   if (!memory) unavailable();
+   double dram_ns = measure_chain(memory);
+   free_buffer(memory, MEMSIZE, backing);
+
+   /* line size: within each block, the second access hits
+      the line of the first access as long as offset < line size */
+   constexpr std::size_t block = 4096;
+   fmt::printf("   offset  time in ns\n");
+   std::vector<Sample> offsets;
+   for (std::size_t offset = sizeof(void*); offset < block; offset *= 2) {
+      memory = create_pair_chain(MEMSIZE, block, offset, backing, SEED);
+      if (!memory) unavailable();
+      double ns = measure_chain(memory);
+      free_buffer(memory, MEMSIZE, backing);
+      offsets.push_back(Sample{offset, ns});
+      fmt::printf(" %8u  %10.5lf\n", offset, ns); std::cout.flush();
+   }
+   /* the largest offsets are not necessarily the slowest ones
+      as prefetchers may kick in */
+   double slowest = 0;
+   for (auto& sample: offsets) {
+      slowest = std::max(slowest, sample.ns);
+   }
+   double midpoint = (offsets.front().ns + slowest) / 2;
+   std::size_t line_size = offsets.back().size;
+   for (auto& sample: offsets) {
+      if (sample.ns >= midpoint) {
+	 line_size = sample.size; break;
+      }
+   }
+   fmt::printf("\n");
+
+   /* access times for n lines that are stride bytes apart */
+   fmt::printf("     ways");
+   for (std::size_t n = 1; n <= MAX_WAYS; ++n) {
+      fmt::printf("  %10u", n);
+   }
+   fmt::printf("\n   stride\n");
+   std::vector<std::size_t> strides;
+   std::vector<std::vector<Sample>> rows;
+   for (std::size_t stride = MIN_STRIDE; stride <= MAX_STRIDE; stride *= 2) {
+      fmt::printf(" %8u", stride);
+      std::vector<Sample> samples;
+      for (std::size_t n = 1; n <= MAX_WAYS; ++n) {
+	 memory = create_strided_chain(n, stride, backing, SEED);
+	 if (!memory) unavailable();
+	 double ns = measure_chain(memory);
+	 free_buffer(memory, n * stride, backing);
+	 samples.push_back(Sample{n, ns});
+	 fmt::printf("  %10.5lf", ns); std::cout.flush();
+      }
+      fmt::printf("\n");
+      strides.push_back(stride);
+      rows.push_back(samples);
+   }
+   fmt::printf("\n");
+
+   /* the plateaus at the largest stride give the access times of
+      the levels; the number of ways of a level is the number of lines
+      that fit before the access times exceed the geometric mean
+      of the access times of this and the next level, and the set
+      span of a level is the smallest stride from where on
+      the same number of lines fit */
+   std::vector<double> times;
+   for (auto& level: detect_levels(rows.back(),
+	 TOLERANCE, MIN_SPAN, MIN_STEP)) {
+      if (level.ns >= DRAM_FRACTION * dram_ns) break;
+      times.push_back(level.ns);
+   }
+   times.push_back(dram_ns);
+   fmt::printf("    level  time in ns        ways    set span        sets\n");
+   bool hashed = false;
+   for (std::size_t i = 0; i + 1 < times.size(); ++i) {
+      double threshold = std::sqrt(times[i] * times[i+1]);
+      std::size_t ways = capacity(rows.back(), threshold);
+      if (ways >= MAX_WAYS) {
+	 /* no conflicts up to MAX_WAYS lines: either the level has
+	    more ways or its set index is hashed */
+	 fmt::printf("       L%u  %10.5lf  %10s  %10s  %10s\n",
+	    i + 1, times[i], "-", "-", "-");
+	 hashed = i + 2 == times.size();
+	 continue;
+      }
+      std::size_t span = strides.back();
+      for (std::size_t r = rows.size();
+	    r-- > 0 && capacity(rows[r], threshold) == ways;) {
+	 span = strides[r];
+      }
+      fmt::printf("       L%u  %10.5lf  %10u  %10u  %10u\n",
+	 i + 1, times[i], ways, span, span / line_size);
+   }
+   fmt::printf("     DRAM  %10.5lf\n", dram_ns);
+   fmt::printf("\n# line size: %u bytes\n", line_size);
+   if (hashed) {
+      fmt::printf("# no conflict misses in the last level cache up to "
+	 "%u lines %u bytes apart:\n"
+	 "# its set index appears to be hashed, e.g. across slices\n",
+	 MAX_WAYS, MAX_STRIDE);
+   }
+   fmt::printf("# %.2lf seconds\n", walltime.elapsed());
+}
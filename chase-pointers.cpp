@@ -26,27 +26,219 @@
 /* follow a circular pointer chain a given number of times
    and return the real time used in seconds as double */
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
 #include <printf.hpp>
 #include "chase-pointers.hpp"
+#include "latency-histogram.hpp"
+#include "perf-counters.hpp"
+#include "timestamp.hpp"
+#include "unrolled-loop.hpp"
 #include "walltime.hpp"
 
 /* this variable must not be declared static */
 volatile void* chase_pointers_global; // to defeat optimizations
 
-/* follow a pointer chain the given number of times and
-   return the measured time */
-double chase_pointers(void** memory, std::size_t count) {
+static const struct {
+   ChaseMode mode;
+   const char* name;
+} chase_mode_names[] = {
+   {ChaseMode::read, "read"},
+   {ChaseMode::store, "store"},
+   {ChaseMode::atomic, "atomic"},
+   {ChaseMode::nontemporal, "nt"},
+};
+
+const char* chase_mode_name(ChaseMode mode) {
+   for (auto& entry: chase_mode_names) {
+      if (entry.mode == mode) return entry.name;
+   }
+   return "?";
+}
+
+bool parse_chase_modes(const char* names, std::vector<ChaseMode>& modes) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 for (auto& entry: chase_mode_names) {
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       modes.push_back(entry.mode);
+	       found = true; break;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+bool chase_mode_supported(ChaseMode mode) {
+   switch (mode) {
+#ifndef __x86_64__
+      case ChaseMode::nontemporal:
+	 return false;
+#endif
+      default:
+	 return true;
+   }
+}
+
+/* follow a pointer chain the given number of times using
+   the given step in a loop unrolled by Unroll
+   and return the measured time */
+template<std::size_t Unroll = chase_defaults::unroll, typename Step>
+static inline double chase(void** memory, std::size_t count,
+      PerfCounters* counters, Step step) {
+   if (counters) counters->start();
    WallTime<double> walltime;
    // chase the pointers count times
    void** p = (void**) memory;
-   while (count-- > 0) {
-      p = (void**) *p;
-   }
+   unrolled_loop<Unroll>(count, [&]() {
+      p = step(p);
+   });
    auto elapsed = walltime.elapsed();
+   if (counters) counters->stop();
    chase_pointers_global = *p;
    return elapsed;
 }
 
+double chase_pointers(void** memory, std::size_t count,
+      PerfCounters* counters, ChaseMode mode) {
+   switch (mode) {
+      case ChaseMode::store:
+	 return chase(memory, count, counters, [](void** p) {
+	    void** next = (void**) *p;
+	    /* volatile keeps the compiler from dropping the store */
+	    *(void* volatile*) p = next;
+	    return next;
+	 });
+      case ChaseMode::atomic:
+	 return chase(memory, count, counters, [](void** p) {
+	    return (void**) __atomic_fetch_add((std::uintptr_t*) p, 0,
+	       __ATOMIC_RELAXED);
+	 });
+#ifdef __x86_64__
+      case ChaseMode::nontemporal: {
+	 double elapsed = chase(memory, count, counters, [](void** p) {
+	    void** next = (void**) *p;
+	    _mm_stream_si64((long long*) p, (long long) next);
+	    return next;
+	 });
+	 _mm_sfence();
+	 return elapsed;
+      }
+#endif
+      default:
+	 return chase(memory, count, counters, [](void** p) {
+	    return (void**) *p;
+	 });
+   }
+}
+
+namespace {
+
+template<std::size_t Unroll>
+double kernel(void** memory, std::size_t count, PerfCounters* counters) {
+   return chase<Unroll>(memory, count, counters, [](void** p) {
+      return (void**) *p;
+   });
+}
+
+/* table of the kernels for the powers of two up to max_unroll */
+constexpr std::size_t nof_kernels = 6;
+static_assert(std::size_t{1} << (nof_kernels - 1) == max_unroll,
+   "nof_kernels does not match max_unroll");
+
+template<std::size_t... I>
+constexpr std::array<ChaseKernel, sizeof...(I)> make_kernels(
+      std::index_sequence<I...>) {
+   return {{&kernel<std::size_t{1} << I>...}};
+}
+
+constexpr auto kernels = make_kernels(std::make_index_sequence<nof_kernels>());
+
+/* likewise for the empty loops */
+using EmptyLoop = double (*)(std::size_t count);
+
+template<std::size_t... I>
+constexpr std::array<EmptyLoop, sizeof...(I)> make_empty_loops(
+      std::index_sequence<I...>) {
+   return {{&empty_loop<std::size_t{1} << I>...}};
+}
+
+constexpr auto empty_loops =
+   make_empty_loops(std::make_index_sequence<nof_kernels>());
+
+/* return the index of the given unroll factor within the tables,
+   nof_kernels if it is not supported */
+std::size_t kernel_index(unsigned int unroll) {
+   std::size_t i = 0;
+   while (i < nof_kernels && (std::size_t{1} << i) != unroll) ++i;
+   return i;
+}
+
+} // namespace
+
+ChaseKernel chase_kernel(unsigned int unroll) {
+   std::size_t i = kernel_index(unroll);
+   return i < nof_kernels? kernels[i]: nullptr;
+}
+
+double chase_loop_overhead(std::size_t count, unsigned int unroll) {
+   std::size_t i = kernel_index(unroll);
+   return i < nof_kernels? empty_loops[i](count): 0;
+}
+
+template<int Locality>
+static double chase_prefetched(void** memory, std::size_t count,
+      PerfCounters* counters) {
+   return chase(memory, count, counters, [](void** p) {
+      __builtin_prefetch(p[1], 0, Locality);
+      return (void**) *p;
+   });
+}
+
+double chase_prefetched_pointers(void** memory, std::size_t count,
+      int locality, PerfCounters* counters) {
+   switch (locality) {
+      case 0: return chase_prefetched<0>(memory, count, counters);
+      case 1: return chase_prefetched<1>(memory, count, counters);
+      case 2: return chase_prefetched<2>(memory, count, counters);
+      default: return chase_prefetched<3>(memory, count, counters);
+   }
+}
+
+std::size_t sample_chase_pointers(void** memory, std::size_t bursts,
+      unsigned int burst_len, double overhead, LatencyHistogram& histogram) {
+   void** p = (void**) memory;
+   std::size_t underflows = 0;
+   while (bursts-- > 0) {
+      std::uint64_t start = read_timestamp();
+      for (unsigned int i = 0; i < burst_len; ++i) {
+	 p = (void**) *p;
+      }
+      std::uint64_t end = read_timestamp();
+      double ticks = (end - start) - overhead;
+      if (ticks < 0) {
+	 ticks = 0; ++underflows;
+      }
+      histogram.add(ticks / burst_len);
+   }
+   chase_pointers_global = *p;
+   return underflows;
+}
+
 /* print pointer chain to std::cout (for debugging) */
 void debug_chain(void** memory) {
    void** p = memory;
@@ -27,9 +27,80 @@
 #ifndef CHASE_POINTERS_HPP
 #define CHASE_POINTERS_HPP
 
+#include <cstddef>
+#include <vector>
+
+class LatencyHistogram;
+class PerfCounters;
+
+/* what is done with each visited pointer besides loading it;
+   as all words of a chain may be part of it, the loaded pointer
+   is written back such that the chain remains intact but
+   the visited cache line becomes dirty */
+enum class ChaseMode {
+   read,	/* just load it */
+   store,	/* store it back */
+   atomic,	/* load it by an atomic fetch-and-add of 0 */
+   nontemporal,	/* store it back using a non-temporal store */
+};
+
+/* return the short name of a chase mode as used in the output,
+   i.e. one of "read", "store", "atomic", or "nt" */
+const char* chase_mode_name(ChaseMode mode);
+
+/* parse a blank- or comma-separated list of chase mode names;
+   false is returned if an unknown name is encountered */
+bool parse_chase_modes(const char* names, std::vector<ChaseMode>& modes);
+
+/* return true if the given chase mode is supported on this platform */
+bool chase_mode_supported(ChaseMode mode);
+
+namespace chase_defaults {
+   /* unroll factor of the loops of chase_pointers */
+   constexpr unsigned int unroll = 8;
+} // namespace chase_defaults
+
 /* follow a circular pointer chain a given number of times
-   and return the real time used in seconds as double */
-double chase_pointers(void** memory, std::size_t count);
+   in a loop unrolled by chase_defaults::unroll
+   and return the real time used in seconds as double;
+   if counters are given, they count the chasing loop */
+double chase_pointers(void** memory, std::size_t count,
+   PerfCounters* counters = nullptr, ChaseMode mode = ChaseMode::read);
+
+/* kernel that follows a circular pointer chain count times in a loop
+   that is unrolled by the factor it has been specialized for and
+   returns the real time used in seconds; if counters are given,
+   they count the chasing loop */
+using ChaseKernel = double (*)(void** memory, std::size_t count,
+   PerfCounters* counters);
+
+/* return the kernel for the given unroll factor which must be a
+   power of two up to max_unroll (32); nullptr is returned otherwise */
+ChaseKernel chase_kernel(unsigned int unroll);
+
+/* run the loop of the kernel for the given unroll factor count
+   times without loading any pointers and return the real time used
+   in seconds, i.e. the loop overhead that remains after unrolling
+   which may be subtracted from the times of the kernel;
+   0 is returned if the unroll factor is not supported */
+double chase_loop_overhead(std::size_t count,
+   unsigned int unroll = chase_defaults::unroll);
+
+/* like chase_pointers for a chain that has been created by
+   init_lookahead_chain where at each step the element referenced
+   by the second word is prefetched with the given temporal
+   locality hint of __builtin_prefetch (0 to 3) */
+double chase_prefetched_pointers(void** memory, std::size_t count,
+   int locality, PerfCounters* counters = nullptr);
+
+/* follow a circular pointer chain in the given number of bursts
+   of burst_len pointers each and add the time per access of each
+   burst in timestamp ticks to the histogram where the given
+   overhead of the timestamp counter is subtracted for each burst;
+   bursts that took less than the overhead are added as 0 and
+   their number is returned */
+std::size_t sample_chase_pointers(void** memory, std::size_t bursts,
+   unsigned int burst_len, double overhead, LatencyHistogram& histogram);
 
 /* print pointer chain to std::cout (for debugging) */
 void debug_chain(void** memory);
@@ -0,0 +1,76 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include "chase-pointers.hpp"
+#include "chase-sweeps.hpp"
+#include "linear-chain.hpp"
+#include "memory-arena.hpp"
+
+/* return the next size of a sweep with the given granularity */
+static std::size_t next_size(std::size_t size, unsigned int granularity) {
+   unsigned int log2 = 0;
+   for (std::size_t val = size; val >>= 1;) {
+      ++log2;
+   }
+   return size + (std::size_t{1} <<
+      (std::max(granularity, log2) - granularity));
+}
+
+std::vector<SweepPoint> random_sweep(const SweepParameters& params) {
+   std::vector<SweepPoint> points;
+   MemoryArena arena(params.max_size, params.backing);
+   if (!arena.available()) return points;
+   for (std::size_t size = params.min_size; size <= params.max_size;
+	 size = next_size(size, params.granularity)) {
+      void** memory = arena.memory();
+      init_random_chain(memory, size, params.seed);
+      auto stats = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, params.measurement);
+      points.push_back(SweepPoint{size, stats});
+   }
+   return points;
+}
+
+std::vector<SweepPoint> linear_sweep(std::size_t min_stride,
+      std::size_t max_stride, const SweepParameters& params) {
+   std::vector<SweepPoint> points;
+   auto size_of = [&](std::size_t stride) {
+      return std::min(params.max_size, stride * 1024 * sizeof(void*));
+   };
+   MemoryArena arena(size_of(max_stride), params.backing);
+   if (!arena.available()) return points;
+   for (std::size_t stride = min_stride; stride <= max_stride;
+	 stride += sizeof(void*)) {
+      void** memory = arena.memory();
+      init_linear_chain(memory, size_of(stride), stride);
+      auto stats = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, params.measurement);
+      points.push_back(SweepPoint{stride, stats});
+   }
+   return points;
+}
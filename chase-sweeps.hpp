@@ -0,0 +1,76 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef CHASE_SWEEPS_HPP
+#define CHASE_SWEEPS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "measurement.hpp"
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+
+/* drivers of the sweeps of random-chase and linear-chase
+   for use as a library where the results are returned
+   instead of being printed */
+
+/* parameters of a sweep which default to those of the utilities */
+struct SweepParameters {
+   std::size_t min_size = 1024;
+   std::size_t max_size = std::size_t{128}<<20;
+   /* for a granularity of n > 0 we get 2^(n-1) sizes in-between
+      two powers of two */
+   unsigned int granularity = 1;
+   Backing backing = Backing::heap;
+   std::uint64_t seed = chase_defaults::seed;
+   MeasurementParameters measurement;
+};
+
+/* measurement of a sweep for the given buffer size or stride */
+struct SweepPoint {
+   std::size_t value;
+   Statistics stats;	/* in ns per access */
+};
+
+/* measure random chains for the buffer sizes from min_size
+   to max_size like random-chase; a buffer of max_size bytes
+   is allocated once with the given backing and reused for all
+   sizes; an empty vector is returned if the backing is not
+   available */
+std::vector<SweepPoint> random_sweep(
+   const SweepParameters& params = SweepParameters());
+
+/* measure linear chains for the strides from min_stride to
+   max_stride in steps of sizeof(void*) like linear-chase where
+   the buffer size for a stride is stride * 1024 * sizeof(void*)
+   but at most max_size bytes; the sizes of params are ignored
+   otherwise; an empty vector is returned if the backing is not
+   available */
+std::vector<SweepPoint> linear_sweep(std::size_t min_stride,
+   std::size_t max_stride,
+   const SweepParameters& params = SweepParameters());
+
+#endif
@@ -0,0 +1,231 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that compares the CSV results of a run (OUTPUT="csv")
+   against a baseline of the same utility and flags the latency
+   or bandwidth regressions that exceed the noise threshold;
+   the exit code is 1 if regressions were found */
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+
+/* metric that is compared */
+#ifndef METRIC
+#define METRIC "median"
+#endif
+/* minimal relative change that is considered as regression
+   or improvement */
+#ifndef THRESHOLD
+#define THRESHOLD 0.05
+#endif
+/* if the results include the standard deviations, a change must
+   in addition exceed this factor times the standard deviation of
+   the difference of both values */
+#ifndef NOISE_FACTOR
+#define NOISE_FACTOR 3.0
+#endif
+
+struct Record {
+   std::string key;
+   std::string group;
+   std::string metric;
+   std::string unit;
+   std::string value;	/* empty if missing */
+};
+
+struct Results {
+   std::vector<std::pair<std::string, std::string>> metadata;
+   std::string key_name;
+   std::vector<Record> records;
+   std::map<std::tuple<std::string, std::string, std::string>,
+      std::size_t> index;
+
+   const Record* find(const std::string& key, const std::string& group,
+	 const std::string& metric) const {
+      auto it = index.find(std::make_tuple(key, group, metric));
+      if (it == index.end()) return nullptr;
+      return &records[it->second];
+   }
+   std::string get(const std::string& name) const {
+      for (auto& entry: metadata) {
+	 if (entry.first == name) return entry.second;
+      }
+      return "-";
+   }
+};
+
+/* split a CSV line into its fields */
+std::vector<std::string> split_csv(const std::string& line) {
+   std::vector<std::string> fields;
+   std::string field;
+   bool quoted = false;
+   for (std::size_t i = 0; i < line.size(); ++i) {
+      char ch = line[i];
+      if (quoted) {
+	 if (ch == '"') {
+	    if (i + 1 < line.size() && line[i+1] == '"') {
+	       field += ch; ++i;
+	    } else {
+	       quoted = false;
+	    }
+	 } else {
+	    field += ch;
+	 }
+      } else if (ch == '"') {
+	 quoted = true;
+      } else if (ch == ',') {
+	 fields.push_back(field); field.clear();
+      } else {
+	 field += ch;
+      }
+   }
+   fields.push_back(field);
+   return fields;
+}
+
+bool read_results(const char* path, Results& results) {
+   std::ifstream in(path);
+   if (!in) {
+      std::cerr << "unable to open " << path << std::endl;
+      return false;
+   }
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty()) continue;
+      if (line[0] == '#') {
+	 auto colon = line.find(": ");
+	 if (colon != std::string::npos && colon > 2) {
+	    results.metadata.emplace_back(line.substr(2, colon - 2),
+	       line.substr(colon + 2));
+	 }
+	 continue;
+      }
+      auto fields = split_csv(line);
+      if (fields.size() != 5) {
+	 std::cerr << path << ": invalid record: " << line << std::endl;
+	 return false;
+      }
+      if (results.key_name.empty()) {
+	 results.key_name = fields[0]; continue;
+      }
+      Record record{fields[0], fields[1], fields[2], fields[3], fields[4]};
+      results.index[std::make_tuple(record.key, record.group,
+	 record.metric)] = results.records.size();
+      results.records.push_back(record);
+   }
+   if (results.key_name.empty()) {
+      std::cerr << path << ": no results found" << std::endl;
+      return false;
+   }
+   return true;
+}
+
+/* +1 if larger values are worse, -1 if smaller values are worse,
+   0 if the unit is not known */
+int direction(const std::string& unit) {
+   if (unit == "ns") return 1;
+   if (unit == "GiB/s") return -1;
+   return 0;
+}
+
+int main(int argc, char** argv) {
+   if (argc != 3) {
+      std::cerr << "Usage: " << argv[0] << " baseline.csv current.csv" <<
+	 std::endl;
+      std::exit(2);
+   }
+   Results baseline, current;
+   if (!read_results(argv[1], baseline) || !read_results(argv[2], current)) {
+      std::exit(2);
+   }
+   if (baseline.get("utility") != current.get("utility") ||
+	 baseline.key_name != current.key_name) {
+      std::cerr << "results of " << baseline.get("utility") << " and " <<
+	 current.get("utility") << " cannot be compared" << std::endl;
+      std::exit(2);
+   }
+
+   /* differences of the metadata tell what has changed in-between */
+   for (auto& entry: current.metadata) {
+      if (entry.first == "date") continue;
+      auto previous = baseline.get(entry.first);
+      if (previous != entry.second) {
+	 fmt::printf("# %s: %s -> %s\n", entry.first, previous, entry.second);
+      }
+   }
+
+   fmt::printf(" %13s  %-16s  %10s  %10s  %8s\n", current.key_name,
+      "group", "baseline", "current", "change");
+   std::size_t compared = 0, regressions = 0, improvements = 0,
+      missing = 0;
+   for (auto& record: current.records) {
+      if (record.metric != METRIC) continue;
+      int sign = direction(record.unit);
+      if (sign == 0) continue;
+      auto base = baseline.find(record.key, record.group, record.metric);
+      if (!base || base->value.empty() || record.value.empty()) {
+	 ++missing; continue;
+      }
+      double old_value = std::stod(base->value);
+      double new_value = std::stod(record.value);
+      if (old_value <= 0) continue;
+      double change = (new_value - old_value) / old_value;
+
+      double tolerance = THRESHOLD;
+      auto old_stddev = baseline.find(record.key, record.group, "stddev");
+      auto new_stddev = current.find(record.key, record.group, "stddev");
+      if (old_stddev && new_stddev &&
+	    !old_stddev->value.empty() && !new_stddev->value.empty()) {
+	 double s1 = std::stod(old_stddev->value);
+	 double s2 = std::stod(new_stddev->value);
+	 double noise = NOISE_FACTOR * std::sqrt(s1*s1 + s2*s2) / old_value;
+	 if (noise > tolerance) tolerance = noise;
+      }
+
+      const char* verdict = "";
+      if (change * sign > tolerance) {
+	 verdict = "regression"; ++regressions;
+      } else if (change * sign < -tolerance) {
+	 verdict = "improvement"; ++improvements;
+      }
+      ++compared;
+      fmt::printf(" %13s  %-16s  %10.5lf  %10.5lf  %+7.2lf%%  %s\n",
+	 record.key, record.group.empty()? "-": record.group,
+	 old_value, new_value, change * 100, verdict);
+   }
+   fmt::printf("\n# %u regressions and %u improvements "
+      "among %u %s values\n", regressions, improvements, compared, METRIC);
+   if (missing > 0) {
+      fmt::printf("# %u values could not be compared\n", missing);
+   }
+   return regressions > 0? 1: 0;
+}
@@ -0,0 +1,191 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* variant of random-chase where at each hop an amount of
+   multiply-adds is done that are independent from the loaded
+   pointers; the results show per cache level how much of this
+   work an out-of-order core is able to overlap with the latency */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "adaptive-sweep.hpp"
+#include "compute-kernels.hpp"
+#include "cpu-topology.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "random-chain.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of multiply-adds per hop, each of them 0 or a power
+   of two up to max_work (1024); 0 is always included */
+#ifndef WORK
+#define WORK "0 4 16 64 256 1024"
+#endif
+/* parameters of the level detection, see cache-levels */
+#ifndef TOLERANCE
+#define TOLERANCE 0.15
+#endif
+#ifndef MIN_SPAN
+#define MIN_SPAN 1.5
+#endif
+#ifndef MIN_STEP
+#define MIN_STEP 1.5
+#endif
+
+int main() {
+   std::vector<unsigned int> work = {0};
+   for (const char* s = WORK; *s; ) {
+      char* end;
+      unsigned long value = std::strtoul(s, &end, 10);
+      if (end == s) {
+	 ++s; continue;
+      }
+      if (value > max_work || !compute_kernel(value)) {
+	 std::cerr << "invalid list of work amounts: " << WORK << std::endl;
+	 std::exit(1);
+      }
+      if (value > 0) work.push_back(value);
+      s = end;
+   }
+   std::sort(work.begin(), work.end());
+   work.erase(std::unique(work.begin(), work.end()), work.end());
+
+   MemoryArena arena(MAX_SIZE, Backing::heap, LOCK_MEMORY);
+   if (LOCK_MEMORY && !arena.locked()) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+
+   fmt::printf("%14s%s\n", "",
+      "  ns per hop for the given number of multiply-adds per hop");
+   fmt::printf("       memsize");
+   for (auto w: work) {
+      fmt::printf("  %10u", w);
+   }
+   fmt::printf("\n");
+
+   /* time of the work alone, i.e. without any loads */
+   std::vector<double> compute;
+   fmt::printf(" %13s", "compute");
+   for (auto w: work) {
+      ComputeKernel kernel = compute_kernel(w);
+      auto stats = measure([=](std::size_t count) {
+	 return kernel(nullptr, count, nullptr);
+      }, measurement_parameters());
+      compute.push_back(stats.median);
+      fmt::printf("  %10.5lf", stats.median);
+      std::cout.flush();
+   }
+   fmt::printf("\n");
+
+   std::vector<Sample> samples; /* for the chase without work */
+   std::vector<std::vector<double>> times;
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      fmt::printf(" %13u", memsize);
+      void** memory = arena.memory();
+      init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+      std::vector<double> row;
+      for (auto w: work) {
+	 ComputeKernel kernel = compute_kernel(w);
+	 auto stats = measure([=](std::size_t count) {
+	    return kernel(memory, count, nullptr);
+	 }, measurement_parameters());
+	 row.push_back(stats.median);
+	 fmt::printf("  %10.5lf", stats.median);
+	 std::cout.flush();
+      }
+      samples.push_back(Sample{memsize, row[0]});
+      times.push_back(row);
+      fmt::printf("\n");
+   }
+
+   /* for each level and amount of work, the share of the shorter
+      of the latency and the time of the work that is hidden,
+      i.e. 100% if the time per hop is the maximum of both and
+      0% if it is their sum; levels that begin beyond the last
+      level cache are main memory */
+   auto levels = detect_levels(samples, TOLERANCE, MIN_SPAN, MIN_STEP);
+   if (levels.empty()) {
+      fmt::printf("\n# no levels detected\n");
+      return 0;
+   }
+   std::size_t caches = cache_levels(levels, last_level_cache_size());
+   fmt::printf("\n%38s%s\n", "",
+      "overlap in % for the given number of multiply-adds per hop");
+   fmt::printf("    level        capacity  time in ns");
+   for (std::size_t j = 1; j < work.size(); ++j) {
+      fmt::printf("  %10u", work[j]);
+   }
+   fmt::printf("\n");
+   for (std::size_t i = 0; i < levels.size(); ++i) {
+      if (i < caches) {
+	 fmt::printf("       L%u  %14u", i + 1, levels[i].last);
+      } else {
+	 fmt::printf("     DRAM  %14s", "-");
+      }
+      std::vector<double> sum(work.size(), 0);
+      std::size_t n = 0;
+      for (std::size_t k = 0; k < samples.size(); ++k) {
+	 if (samples[k].size < levels[i].first ||
+	       samples[k].size > levels[i].last) continue;
+	 for (std::size_t j = 0; j < work.size(); ++j) {
+	    sum[j] += times[k][j];
+	 }
+	 ++n;
+      }
+      double latency = sum[0] / n;
+      fmt::printf("  %10.5lf", latency);
+      for (std::size_t j = 1; j < work.size(); ++j) {
+	 double t = sum[j] / n;
+	 double overlap = (latency + compute[j] - t) /
+	    std::min(latency, compute[j]);
+	 overlap = std::max(0.0, std::min(1.0, overlap));
+	 fmt::printf("  %10.1lf", overlap * 100);
+      }
+      fmt::printf("\n");
+   }
+}
@@ -0,0 +1,119 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "compute-kernels.hpp"
+#include "walltime.hpp"
+
+/* these variables must not be declared static */
+volatile void* compute_chase_global; // to defeat optimizations
+volatile double compute_work_global;
+/* operands of the multiply-adds which are read at run time
+   to prevent constant folding; the accumulators converge
+   to 2 such that neither overflows nor denormals occur */
+volatile double compute_factor = 0.5;
+volatile double compute_summand = 1.0;
+
+namespace {
+
+constexpr unsigned int lanes = 8;
+
+/* keep x in a register of its own such that the accumulators
+   are neither vectorized nor kept in memory */
+inline void keep(double& x) {
+#if defined(__x86_64__)
+   asm("" : "+x"(x));
+#elif defined(__aarch64__)
+   asm("" : "+w"(x));
+#endif
+}
+
+/* one multiply-add on each of the first sizeof...(J) accumulators */
+template<std::size_t... J>
+inline void multiply_add(double* acc, double a, double b,
+      std::index_sequence<J...>) {
+   using expander = int[];
+   (void) expander{0, (acc[J] = acc[J] * a + b, keep(acc[J]), 0)...};
+}
+
+template<unsigned int Work, bool Load>
+double loop(void** memory, std::size_t count, PerfCounters* counters) {
+   double a = compute_factor;
+   double b = compute_summand;
+   double acc[lanes] = {0, 1, 2, 3, 4, 5, 6, 7};
+   if (counters) counters->start();
+   WallTime<double> walltime;
+   void** p = memory;
+   while (count-- > 0) {
+      if (Load) p = (void**) *p;
+      for (unsigned int i = 0; i < Work / lanes; ++i) {
+	 multiply_add(acc, a, b, std::make_index_sequence<lanes>());
+      }
+      multiply_add(acc, a, b, std::make_index_sequence<Work % lanes>());
+   }
+   auto elapsed = walltime.elapsed();
+   if (counters) counters->stop();
+   if (Load) compute_chase_global = *p;
+   compute_work_global = acc[0] + acc[1] + acc[2] + acc[3] +
+      acc[4] + acc[5] + acc[6] + acc[7];
+   return elapsed;
+}
+
+template<unsigned int Work>
+double kernel(void** memory, std::size_t count, PerfCounters* counters) {
+   if (memory) {
+      return loop<Work, true>(memory, count, counters);
+   } else {
+      return loop<Work, false>(memory, count, counters);
+   }
+}
+
+/* table of the kernels for 0 and the powers of two up to max_work */
+constexpr std::size_t nof_kernels = 12;
+static_assert(1u << (nof_kernels - 2) == max_work,
+   "nof_kernels does not match max_work");
+
+constexpr unsigned int work_of(std::size_t index) {
+   return index == 0? 0: 1u << (index - 1);
+}
+
+template<std::size_t... I>
+constexpr std::array<ComputeKernel, sizeof...(I)> make_kernels(
+      std::index_sequence<I...>) {
+   return {{&kernel<work_of(I)>...}};
+}
+
+constexpr auto kernels = make_kernels(std::make_index_sequence<nof_kernels>());
+
+} // namespace
+
+ComputeKernel compute_kernel(unsigned int work) {
+   for (std::size_t i = 0; i < nof_kernels; ++i) {
+      if (work_of(i) == work) return kernels[i];
+   }
+   return nullptr;
+}
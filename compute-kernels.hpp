@@ -0,0 +1,50 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef COMPUTE_KERNELS_HPP
+#define COMPUTE_KERNELS_HPP
+
+#include <cstddef>
+#include "perf-counters.hpp"
+
+/* maximal amount of work per hop supported by compute_kernel */
+constexpr unsigned int max_work = 1024;
+
+/* kernel that follows a circular pointer chain count times and
+   performs at each hop the amount of work it has been specialized
+   for, i.e. multiply-adds on eight accumulators which are independent
+   from the chain such that an out-of-order core can overlap them
+   with the loads; if memory is nullptr, just the work is done;
+   the real time used in seconds is returned and, if counters are
+   given, they count the loop */
+using ComputeKernel = double (*)(void** memory, std::size_t count,
+   PerfCounters* counters);
+
+/* return the kernel for the given number of multiply-adds per hop
+   which must be 0 or a power of two up to max_work;
+   nullptr is returned for other amounts */
+ComputeKernel compute_kernel(unsigned int work);
+
+#endif
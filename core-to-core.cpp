@@ -0,0 +1,171 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that measures the latency of cache-line transfers
+   between all pairs of logical CPUs: two pinned threads bounce
+   a cache line between them where each of them waits for the
+   value stored by the other and responds by storing the
+   next value */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "cpu-affinity.hpp"
+#include "cpu-topology.hpp"
+#include "measurement.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+/* list of logical CPUs like "0-3,8", all available CPUs by default */
+#ifndef CPUS
+#define CPUS ""
+#endif
+/* time budget in seconds for each pair of CPUs */
+#ifndef PAIR_BUDGET
+#define PAIR_BUDGET 0.1
+#endif
+
+/* assumed cache line size to keep the flag on a line of its own */
+constexpr std::size_t line_size = 64;
+
+struct alignas(line_size) Line {
+   std::atomic<std::uint64_t> value;
+};
+
+/* one-way transfer time in ns between the given CPUs
+   where the calling thread pings and a pinned thread pongs */
+double transfer_time(unsigned int ping_cpu, unsigned int pong_cpu,
+      const MeasurementParameters& params) {
+   Line line; line.value.store(0);
+   Line stop; stop.value.store(0);
+   std::thread pong([&]() {
+      pin_thread(pong_cpu);
+      while (!stop.value.load(std::memory_order_relaxed)) {
+	 std::uint64_t v = line.value.load(std::memory_order_acquire);
+	 if (v & 1) line.value.store(v + 1, std::memory_order_release);
+      }
+   });
+   pin_thread(ping_cpu);
+   auto stats = measure([&](std::size_t count) {
+      WallTime<double> walltime;
+      std::uint64_t v = line.value.load(std::memory_order_acquire);
+      while (count-- > 0) {
+	 line.value.store(v + 1, std::memory_order_release);
+	 v += 2;
+	 while (line.value.load(std::memory_order_acquire) != v);
+      }
+      return walltime.elapsed();
+   }, params);
+   stop.value.store(1);
+   pong.join();
+   /* one round trip consists of two transfers */
+   return stats.median / 2;
+}
+
+int main() {
+   auto available = available_cpus();
+   std::vector<unsigned int> cpus = parse_cpu_list(CPUS);
+   if (cpus.empty()) cpus = available;
+   std::vector<CpuLocation> locations;
+   for (auto cpu: cpus) {
+      locations.push_back(cpu_location(cpu));
+   }
+   /* order the CPUs by their topology such that close CPUs
+      are grouped together */
+   std::sort(locations.begin(), locations.end(),
+      [](const CpuLocation& a, const CpuLocation& b) {
+	 return std::make_tuple(a.package, a.die, a.l3, a.l2, a.core, a.cpu) <
+	    std::make_tuple(b.package, b.die, b.l3, b.l2, b.core, b.cpu);
+      });
+   std::size_t n = locations.size();
+
+   fmt::printf("      cpu    core      l2      l3     die package\n");
+   for (auto& location: locations) {
+      fmt::printf(" %8u", location.cpu);
+      for (int id: {location.core, location.l2, location.l3,
+	    location.die, location.package}) {
+	 if (id >= 0) {
+	    fmt::printf(" %7d", id);
+	 } else {
+	    fmt::printf(" %7s", "-");
+	 }
+      }
+      fmt::printf("\n");
+   }
+
+   MeasurementParameters params = measurement_parameters();
+   params.sample_time = PAIR_BUDGET / 100;
+   params.time_budget = PAIR_BUDGET;
+   std::vector<std::vector<double>> latency(n, std::vector<double>(n, -1));
+   for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = i + 1; j < n; ++j) {
+	 latency[i][j] = latency[j][i] =
+	    transfer_time(locations[i].cpu, locations[j].cpu, params);
+      }
+   }
+
+   fmt::printf("\none-way cache-line transfer latency in ns\n");
+   fmt::printf("      cpu");
+   for (auto& location: locations) {
+      fmt::printf(" %7u", location.cpu);
+   }
+   fmt::printf("\n");
+   for (std::size_t i = 0; i < n; ++i) {
+      fmt::printf(" %8u", locations[i].cpu);
+      for (std::size_t j = 0; j < n; ++j) {
+	 if (latency[i][j] >= 0) {
+	    fmt::printf(" %7.1lf", latency[i][j]);
+	 } else {
+	    fmt::printf(" %7s", "-");
+	 }
+      }
+      fmt::printf("\n");
+   }
+
+   /* summary for each relation of two CPUs */
+   fmt::printf("\n relation   pairs         min      median         max\n");
+   for (auto relation: {CpuRelation::smt, CpuRelation::l2, CpuRelation::l3,
+	 CpuRelation::die, CpuRelation::package, CpuRelation::remote}) {
+      std::vector<double> values;
+      for (std::size_t i = 0; i < n; ++i) {
+	 for (std::size_t j = i + 1; j < n; ++j) {
+	    if (cpu_relation(locations[i], locations[j]) == relation) {
+	       values.push_back(latency[i][j]);
+	    }
+	 }
+      }
+      if (values.empty()) continue;
+      std::sort(values.begin(), values.end());
+      fmt::printf(" %8s  %6u  %10.5lf  %10.5lf  %10.5lf\n",
+	 cpu_relation_name(relation), values.size(),
+	 values.front(), values[values.size() / 2], values.back());
+   }
+}
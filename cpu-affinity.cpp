@@ -0,0 +1,77 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <sched.h>
+#include "cpu-affinity.hpp"
+
+/* return the logical CPUs the current process is allowed to run on
+   in ascending order */
+std::vector<unsigned int> available_cpus() {
+   std::vector<unsigned int> cpus;
+   cpu_set_t set;
+   CPU_ZERO(&set);
+   if (sched_getaffinity(0, sizeof set, &set) == 0) {
+      for (unsigned int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+	 if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+      }
+   }
+   if (cpus.empty()) cpus.push_back(0);
+   return cpus;
+}
+
+/* pin the calling thread to the given logical CPU;
+   false is returned if this is not permitted or not supported */
+bool pin_thread(unsigned int cpu) {
+   if (cpu >= CPU_SETSIZE) return false;
+   cpu_set_t set;
+   CPU_ZERO(&set);
+   CPU_SET(cpu, &set);
+   /* on Linux, pid 0 refers to the calling thread */
+   return sched_setaffinity(0, sizeof set, &set) == 0;
+}
+
+/* parse a list like "0-3,8,10-11" as found in /sys/devices/system;
+   the numbers are returned in the order of the list */
+std::vector<unsigned int> parse_cpu_list(const std::string& list) {
+   std::vector<unsigned int> cpus;
+   const char* s = list.c_str();
+   for(;;) {
+      while (*s == ',' || *s == ' ' || *s == '\n') ++s;
+      if (*s < '0' || *s > '9') break;
+      char* end;
+      unsigned int first = std::strtoul(s, &end, 10);
+      unsigned int last = first;
+      s = end;
+      if (*s == '-') {
+	 last = std::strtoul(s + 1, &end, 10);
+	 s = end;
+      }
+      for (unsigned int cpu = first; cpu <= last; ++cpu) {
+	 cpus.push_back(cpu);
+      }
+   }
+   return cpus;
+}
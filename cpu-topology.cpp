@@ -0,0 +1,147 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <sched.h>
+#include "cpu-affinity.hpp"
+#include "cpu-topology.hpp"
+
+static const char* sysfs_cpu_dir = "/sys/devices/system/cpu";
+
+/* read the first line of the given file, empty if not accessible */
+static std::string read_line(const std::string& path) {
+   std::ifstream in(path);
+   std::string line;
+   if (in) std::getline(in, line);
+   return line;
+}
+
+/* return the smallest CPU of the list in the given file, -1 if none */
+static int first_cpu(const std::string& path) {
+   auto cpus = parse_cpu_list(read_line(path));
+   if (cpus.empty()) return -1;
+   unsigned int first = cpus.front();
+   for (auto cpu: cpus) {
+      if (cpu < first) first = cpu;
+   }
+   return first;
+}
+
+/* return the number in the given file, -1 if not accessible */
+static int read_id(const std::string& path) {
+   std::string line = read_line(path);
+   if (line.empty()) return -1;
+   return std::stoi(line);
+}
+
+CpuLocation cpu_location(unsigned int cpu) {
+   std::string dir = std::string(sysfs_cpu_dir) + "/cpu" +
+      std::to_string(cpu);
+   CpuLocation location{cpu, -1, -1, -1, -1, -1};
+   location.core = first_cpu(dir + "/topology/thread_siblings_list");
+   location.die = read_id(dir + "/topology/die_id");
+   location.package = read_id(dir + "/topology/physical_package_id");
+   for (unsigned int index = 0;; ++index) {
+      std::string cache = dir + "/cache/index" + std::to_string(index);
+      std::string level = read_line(cache + "/level");
+      if (level.empty()) break;
+      if (read_line(cache + "/type") == "Instruction") continue;
+      int shared = first_cpu(cache + "/shared_cpu_list");
+      if (level == "2") location.l2 = shared;
+      if (level == "3") location.l3 = shared;
+   }
+   return location;
+}
+
+/* return the size in the given file like "48K", 0 if not accessible */
+static std::size_t read_size(const std::string& path) {
+   std::string line = read_line(path);
+   if (line.empty()) return 0;
+   std::size_t pos;
+   std::size_t size = std::stoul(line, &pos);
+   switch (pos < line.size()? line[pos]: ' ') {
+      case 'K': return size << 10;
+      case 'M': return size << 20;
+      case 'G': return size << 30;
+      default: return size;
+   }
+}
+
+std::vector<CpuCache> cpu_caches(unsigned int cpu) {
+   std::string dir = std::string(sysfs_cpu_dir) + "/cpu" +
+      std::to_string(cpu);
+   std::vector<CpuCache> caches;
+   for (unsigned int index = 0;; ++index) {
+      std::string cache = dir + "/cache/index" + std::to_string(index);
+      int level = read_id(cache + "/level");
+      if (level < 0) break;
+      if (read_line(cache + "/type") == "Instruction") continue;
+      std::size_t size = read_size(cache + "/size");
+      std::size_t line_size = read_size(cache + "/coherency_line_size");
+      if (size == 0) continue;
+      caches.push_back(CpuCache{(unsigned int) level, size,
+	 line_size? line_size: 64});
+   }
+   std::sort(caches.begin(), caches.end(),
+      [](const CpuCache& a, const CpuCache& b) {
+	 return a.level < b.level;
+      });
+   return caches;
+}
+
+std::size_t last_level_cache_size() {
+   int cpu = sched_getcpu();
+   auto caches = cpu_caches(cpu >= 0? cpu: 0);
+   if (caches.empty()) return 0;
+   return caches.back().size;
+}
+
+CpuRelation cpu_relation(const CpuLocation& a, const CpuLocation& b) {
+   auto same = [](int x, int y) { return x >= 0 && x == y; };
+   if (a.cpu == b.cpu) return CpuRelation::same;
+   if (same(a.core, b.core)) return CpuRelation::smt;
+   if (same(a.l2, b.l2)) return CpuRelation::l2;
+   if (same(a.l3, b.l3)) return CpuRelation::l3;
+   /* different packages require both package ids to be known */
+   if (a.package < 0 || b.package < 0) return CpuRelation::package;
+   if (a.package != b.package) return CpuRelation::remote;
+   if (same(a.die, b.die)) return CpuRelation::die;
+   return CpuRelation::package;
+}
+
+const char* cpu_relation_name(CpuRelation relation) {
+   switch (relation) {
+      case CpuRelation::same: return "same";
+      case CpuRelation::smt: return "smt";
+      case CpuRelation::l2: return "l2";
+      case CpuRelation::l3: return "l3";
+      case CpuRelation::die: return "die";
+      case CpuRelation::package: return "package";
+      case CpuRelation::remote: return "remote";
+   }
+   return "?";
+}
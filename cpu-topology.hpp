@@ -0,0 +1,82 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef CPU_TOPOLOGY_HPP
+#define CPU_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <vector>
+
+/* location of a logical CPU where each level is identified by
+   the smallest logical CPU that shares it, or the id given by
+   the kernel for dies and packages; -1 if it is not known */
+struct CpuLocation {
+   unsigned int cpu;
+   int core;		/* shared by SMT siblings */
+   int l2;		/* CPUs sharing the L2 cache, e.g. a cluster */
+   int l3;		/* CPUs sharing the L3 cache, e.g. a CCX */
+   int die;
+   int package;		/* socket */
+};
+
+/* closest relation of two logical CPUs, from the closest
+   to the farthest */
+enum class CpuRelation {
+   same,	/* identical logical CPUs */
+   smt,		/* SMT siblings of the same core */
+   l2,		/* sharing the L2 cache */
+   l3,		/* sharing the L3 cache */
+   die,		/* on the same die */
+   package,	/* on the same package or package not known */
+   remote,	/* on different packages */
+};
+
+/* data or unified cache of a logical CPU */
+struct CpuCache {
+   unsigned int level;
+   std::size_t size;		/* in bytes */
+   std::size_t line_size;	/* in bytes */
+};
+
+/* return the data and unified caches of the given logical CPU in
+   ascending order of their levels as found in /sys/devices/system/cpu;
+   an empty vector is returned if they are not known */
+std::vector<CpuCache> cpu_caches(unsigned int cpu);
+
+/* return the size of the last level data or unified cache of the
+   logical CPU the calling thread runs on; 0 if it is not known */
+std::size_t last_level_cache_size();
+
+/* return the location of the given logical CPU as found in
+   /sys/devices/system/cpu */
+CpuLocation cpu_location(unsigned int cpu);
+
+/* return the closest relation of the two given locations */
+CpuRelation cpu_relation(const CpuLocation& a, const CpuLocation& b);
+
+/* return the short name of a relation, e.g. "smt" */
+const char* cpu_relation_name(CpuRelation relation);
+
+#endif
@@ -0,0 +1,143 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "file-mapping.hpp"
+
+static const struct {
+   MapAdvice advice;
+   const char* name;
+   int flag;
+} advice_names[] = {
+   {MapAdvice::normal, "normal", MADV_NORMAL},
+   {MapAdvice::random, "random", MADV_RANDOM},
+   {MapAdvice::sequential, "seq", MADV_SEQUENTIAL},
+   {MapAdvice::willneed, "willneed", MADV_WILLNEED},
+};
+
+const char* advice_name(MapAdvice advice) {
+   for (auto& entry: advice_names) {
+      if (entry.advice == advice) return entry.name;
+   }
+   return "?";
+}
+
+static int advice_flag(MapAdvice advice) {
+   for (auto& entry: advice_names) {
+      if (entry.advice == advice) return entry.flag;
+   }
+   return MADV_NORMAL;
+}
+
+bool parse_advices(const char* names, std::vector<MapAdvice>& advices) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 for (auto& entry: advice_names) {
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       advices.push_back(entry.advice);
+	       found = true; break;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+std::size_t FileMapping::page_size() {
+   return sysconf(_SC_PAGESIZE);
+}
+
+FileMapping::FileMapping(const std::string& dir, std::size_t capacity,
+      MapAdvice advice, bool populate) :
+      nof_bytes((capacity + page_size() - 1) / page_size() * page_size()),
+      kind(advice), fd(-1), buffer(nullptr) {
+   std::string path = dir + "/pointer-chasing-XXXXXX";
+   std::vector<char> name(path.begin(), path.end());
+   name.push_back(0);
+   fd = mkstemp(name.data());
+   if (fd < 0) return;
+   unlink(name.data());
+   if (ftruncate(fd, nof_bytes) != 0) return;
+   map(nullptr, populate);
+}
+
+FileMapping::~FileMapping() {
+   if (buffer) munmap(buffer, nof_bytes);
+   if (fd >= 0) close(fd);
+}
+
+bool FileMapping::map(void* address, bool populate) {
+   int flags = MAP_SHARED;
+   if (address) flags |= MAP_FIXED;
+   if (populate) flags |= MAP_POPULATE;
+   void* mapping = mmap(address, nof_bytes, PROT_READ | PROT_WRITE,
+      flags, fd, 0);
+   if (mapping == MAP_FAILED) {
+      buffer = nullptr; return false;
+   }
+   buffer = mapping;
+   /* failure is acceptable as the advice is just a hint */
+   madvise(buffer, nof_bytes, advice_flag(kind));
+   return true;
+}
+
+bool FileMapping::drop_pages(std::size_t size) {
+   if (!buffer) return false;
+   if (size > nof_bytes) size = nof_bytes;
+   msync(buffer, size, MS_SYNC);
+   /* the pages can be evicted only if they are no longer mapped;
+      the same address is taken again as the chain consists of
+      absolute addresses; MAP_POPULATE would read all
+      pages back in right away */
+   void* address = buffer;
+   munmap(buffer, nof_bytes);
+   posix_fadvise(fd, 0, size, POSIX_FADV_DONTNEED);
+   return map(address, false);
+}
+
+double FileMapping::resident(std::size_t size) const {
+   if (!buffer || size == 0) return 0;
+   if (size > nof_bytes) size = nof_bytes;
+   std::size_t pages = (size + page_size() - 1) / page_size();
+   std::vector<unsigned char> vec(pages);
+   if (mincore(buffer, size, vec.data()) != 0) return 0;
+   std::size_t count = 0;
+   for (auto v: vec) {
+      if (v & 1) ++count;
+   }
+   return static_cast<double>(count) / pages;
+}
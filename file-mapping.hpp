@@ -0,0 +1,95 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef FILE_MAPPING_HPP
+#define FILE_MAPPING_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/* advice for the access pattern of a file mapping, see madvise(2) */
+enum class MapAdvice {
+   normal,	/* MADV_NORMAL: default readahead */
+   random,	/* MADV_RANDOM: no readahead */
+   sequential,	/* MADV_SEQUENTIAL: aggressive readahead */
+   willneed,	/* MADV_WILLNEED: read ahead the whole mapping */
+};
+
+/* return the short name of an advice as used in the output,
+   i.e. one of "normal", "random", "seq", or "willneed" */
+const char* advice_name(MapAdvice advice);
+
+/* parse a blank- or comma-separated list of advice names;
+   false is returned if an unknown name is encountered */
+bool parse_advices(const char* names, std::vector<MapAdvice>& advices);
+
+/* shared mapping of a temporary file in the given directory,
+   e.g. on tmpfs or on a local file system whose page cache
+   backs the mapping; the file is unlinked right after its
+   creation such that it disappears with the mapping;
+   if populate is true, the mapping is created with MAP_POPULATE
+   (but not when it is mapped anew by drop_pages) */
+class FileMapping {
+   public:
+      FileMapping(const std::string& dir, std::size_t capacity,
+	 MapAdvice advice = MapAdvice::normal, bool populate = false);
+      ~FileMapping();
+      FileMapping(const FileMapping&) = delete;
+      FileMapping& operator=(const FileMapping&) = delete;
+
+      /* false if the file could not be created or mapped */
+      bool available() const { return buffer != nullptr; }
+      std::size_t capacity() const { return nof_bytes; }
+      MapAdvice advice() const { return kind; }
+      /* size of the pages of the mapping in bytes */
+      static std::size_t page_size();
+
+      /* return the beginning of the mapping;
+	 chains of any size up to the capacity can be placed there */
+      void** memory() const { return (void**) buffer; }
+
+      /* write the first size bytes back to the file, evict them
+	 from the page cache, and map the file anew at the same
+	 address without MAP_POPULATE such that the next accesses
+	 fault them in from the file; this is not possible for tmpfs
+	 where the pages remain resident; false is returned if the
+	 mapping is lost */
+      bool drop_pages(std::size_t size);
+
+      /* return the fraction of the pages of the first size bytes
+	 that are resident in the page cache */
+      double resident(std::size_t size) const;
+
+   private:
+      bool map(void* address, bool populate);
+
+      std::size_t nof_bytes;
+      MapAdvice kind;
+      int fd;
+      void* buffer;
+};
+
+#endif
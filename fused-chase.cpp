@@ -0,0 +1,135 @@
+/* 
+   Copyright (c) 2016, 2018, 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "fused-chase.hpp"
+#include "measurement.hpp"
+#include "utility-config.hpp"
+
+/* this variable must not be declared static */
+volatile void* fused_chase_global; // to defeat optimizations
+
+namespace {
+
+/* the pointers are loaded from the array just once and
+   then chased as locals of fused_chase */
+template<std::size_t... I>
+double chase_array(PerfCounters* counters, std::size_t count,
+      void*** ptrs, std::index_sequence<I...>) {
+   return fused_chase<UNROLL>(counters, count, ptrs[I]...);
+}
+
+template<std::size_t Fuse>
+double kernel(PerfCounters* counters, std::size_t count, void*** ptrs) {
+   return chase_array(counters, count, ptrs,
+      std::make_index_sequence<Fuse>());
+}
+
+/* table of the kernels for the fuse factors 1 to sizeof...(I) */
+template<std::size_t... I>
+constexpr std::array<FusedKernel, sizeof...(I)> make_kernels(
+      std::index_sequence<I...>) {
+   return {{&kernel<I + 1>...}};
+}
+
+constexpr auto kernels = make_kernels(std::make_index_sequence<max_fuse>());
+
+} // namespace
+
+FusedKernel fused_kernel(std::size_t fuse) {
+   return kernels[fuse - 1];
+}
+
+void print_fused_header(const char* name, std::size_t min_fuse,
+      std::size_t max_fuse, PerfCounters* counters) {
+   std::size_t nof_counters = counters? counters->size(): 0;
+   fmt::printf("     fuse");
+   for (std::size_t fuse = min_fuse; fuse <= max_fuse; ++fuse) {
+      std::string number = std::to_string(fuse);
+      fmt::printf("%s%s",
+	 std::string(36 + 12 * nof_counters - number.size(), ' '), number);
+   }
+   fmt::printf("\n %8s", name);
+   for (std::size_t fuse = min_fuse; fuse <= max_fuse; ++fuse) {
+      fmt::printf("      median         max      stddev");
+      for (std::size_t j = 0; j < nof_counters; ++j) {
+	 fmt::printf("  %10s", counters->name(j));
+      }
+   }
+   fmt::printf("\n");
+}
+
+/* overhead of the unrolled loop in ns per iteration which is
+   subtracted from the times if SUBTRACT_OVERHEAD is defined */
+static double loop_overhead() {
+#ifdef SUBTRACT_OVERHEAD
+   static double overhead = measure([](std::size_t count) {
+      return empty_loop<UNROLL>(count);
+   }, measurement_parameters()).median;
+   return overhead;
+#else
+   return 0;
+#endif
+}
+
+void print_fused_result(std::size_t fuse, void*** ptrs,
+      PerfCounters* counters, ResultTable& table) {
+   FusedKernel chase = fused_kernel(fuse);
+   if (counters) counters->reset();
+   std::size_t accesses = 0;
+   auto stats = measure([&](std::size_t count) {
+      accesses += count * fuse;
+      return chase(counters, count, ptrs);
+   }, measurement_parameters());
+   double overhead = loop_overhead();
+   stats.median -= overhead;
+   stats.min -= overhead;
+   /* the statistics in ns per iteration are converted into
+      speeds where the minimal time gives the maximal speed
+      and the standard deviation is scaled accordingly */
+   auto volume = static_cast<double>(sizeof(void*)) * fuse;
+   auto speed = [=](double ns) {
+      return volume / ns * 1000000000 / (1<<30); /* in GiB/s */
+   };
+   auto median = speed(stats.median);
+   std::string group = std::to_string(fuse);
+   table.add(group, "median", median);
+   table.add(group, "max", speed(stats.min));
+   table.add(group, "stddev", median * stats.stddev / stats.median);
+   if (counters) {
+      for (std::size_t j = 0; j < counters->size(); ++j) {
+	 if (counters->scheduled()) {
+	    table.add(group, counters->name(j),
+	       counters->value(j) / accesses, "per access");
+	 } else {
+	    table.add_missing(group, counters->name(j), "per access");
+	 }
+      }
+   }
+}
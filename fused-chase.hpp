@@ -0,0 +1,94 @@
+/* 
+   Copyright (c) 2016, 2018, 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef FUSED_CHASE_HPP
+#define FUSED_CHASE_HPP
+
+#include <cstddef>
+#include "perf-counters.hpp"
+#include "result-table.hpp"
+#include "unrolled-loop.hpp"
+#include "walltime.hpp"
+
+/* maximal fuse factor supported by fused_kernel */
+constexpr std::size_t max_fuse = 32;
+
+/* apply body to all objects in the given order */
+template<typename Body, typename... Objects>
+inline void fused_action(Body body, Objects&... objects) {
+   using expander = int[];
+   (void) expander{0, (body(objects), 0)...};
+}
+
+/* defined in fused-chase.cpp, must not be declared static */
+extern volatile void* fused_chase_global; // to defeat optimizations
+
+/* chase all pointers count times in an interleaved pattern
+   in a loop unrolled by Unroll and return the real time used
+   in seconds; if counters are given, they count the chasing loop;
+   the pointers are taken by value such that the chase runs on
+   locals which can be kept in registers, the final positions
+   are not passed back; flatten inlines the unrolled loop with
+   its body even for large unroll factors as otherwise the body
+   would be called with the locals captured by reference */
+template<std::size_t Unroll, typename... Pointers>
+__attribute__((flatten))
+double fused_chase(PerfCounters* counters, std::size_t count,
+      Pointers... ptrs) {
+   if (counters) counters->start();
+   WallTime<double> walltime;
+   // chase the pointers count times
+   unrolled_loop<Unroll>(count, [&]() {
+      fused_action([](void**& p) { p = (void**) *p; }, ptrs...);
+   });
+   auto elapsed = walltime.elapsed();
+   if (counters) counters->stop();
+   // defeat the optimization that removes the chasing
+   fused_action([](void**& p) { fused_chase_global = *p; }, ptrs...);
+   return elapsed;
+}
+
+/* kernel that chases the first n pointers of the given array
+   where n is the fuse factor it has been specialized for */
+using FusedKernel = double (*)(PerfCounters* counters, std::size_t count,
+   void*** ptrs);
+
+/* return the kernel for the given fuse factor, 1 <= fuse <= max_fuse */
+FusedKernel fused_kernel(std::size_t fuse);
+
+/* print the two header lines with a group of columns for
+   each fuse factor from min_fuse to max_fuse where the
+   first column of the second line is titled by the given name */
+void print_fused_header(const char* name, std::size_t min_fuse,
+   std::size_t max_fuse, PerfCounters* counters);
+
+/* measure the kernel for the given fuse factor and add the
+   median, the maximum, and the standard deviation of the aggregated
+   data access speed in GiB/s, followed by the counters per access,
+   to the current row of the table */
+void print_fused_result(std::size_t fuse, void*** ptrs,
+   PerfCounters* counters, ResultTable& table);
+
+#endif
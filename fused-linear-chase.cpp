@@ -1,5 +1,5 @@
 /* 
-   Copyright (c) 2016, 2018 Andreas F. Borchert
+   Copyright (c) 2016, 2018, 2026 Andreas F. Borchert
    All rights reserved.
 
    Permission is hereby granted, free of charge, to any person obtaining
@@ -26,43 +26,21 @@
 /* this utility is an extension of the linear-chase:
    where linear-chase just has one pointer chase using a constant stride,
    this utility chases n pointers in an interleaved pattern
-   for n running from 1 to 8 */
+   for n running from MIN_FUSE to MAX_FUSE */
 
 #include <algorithm>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
-#include <unistd.h>
-#include <sys/times.h>
+#include <memory>
+#include <string>
 #include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "fused-chase.hpp"
 #include "linear-chain.hpp"
-#include "walltime.hpp"
-
-template<typename Body, typename Object>
-inline void fused_action(Body body, Object& object) {
-   body(object);
-}
-template<typename Body, typename Object, typename... Objects>
-inline void fused_action(Body body, Object& object, Objects&... objects) {
-   body(object);
-   fused_action(body, objects...);
-}
-
-/* this variable must not be declared static */
-volatile void* fused_linear_global; // to defeat optimizations
-
-template<typename... Pointers>
-double fused_chase(std::size_t count, Pointers&... ptrs) {
-   WallTime<double> walltime;
-   // chase the pointers count times
-   while (count-- > 0) {
-      fused_action([](void**& p) { p = (void**) *p; }, ptrs...);
-   }
-   auto elapsed = walltime.elapsed();
-   // defeat the optimization that removes the chasing
-   fused_action([](void**& p) { fused_linear_global = *p; }, ptrs...);
-   return elapsed;
-}
+#include "memory-arena.hpp"
+#include "perf-counters.hpp"
+#include "result-table.hpp"
+#include "utility-config.hpp"
 
 #ifndef MIN_STRIDE
 #define MIN_STRIDE (sizeof(void*))
@@ -70,47 +48,68 @@ double fused_chase(std::size_t count, Pointers&... ptrs) {
 #ifndef MAX_STRIDE
 #define MAX_STRIDE 120
 #endif
+/* range of fuse factors, at most max_fuse (32) */
+#ifndef MIN_FUSE
+#define MIN_FUSE 1
+#endif
+#ifndef MAX_FUSE
+#define MAX_FUSE 8
+#endif
+static_assert(MIN_FUSE >= 1 && MIN_FUSE <= MAX_FUSE && MAX_FUSE <= max_fuse,
+   "fuse factors must be in the range of 1 to max_fuse");
+/* if PERF_COUNTERS is defined, hardware performance counters
+   per access are given for each fuse factor where available */
 
 int main() {
-   void **p1, **p2, **p3, **p4, **p5, **p6, **p7, **p8;
-   void **m1, **m2, **m3, **m4, **m5, **m6, **m7, **m8;
-   fmt::printf("                                          "
-      "data access speeds in GiB/s\n");
-   fmt::printf("     fuse");
-   for (int i = 1; i <= 8; ++i) fmt::printf("%12d", i);
-   fmt::printf("\n    stride\n");
+   /* one arena per chain that is reused for all strides */
+   std::size_t max_memsize = std::min(std::size_t{1}<<26,
+      std::size_t{MAX_STRIDE} * 1024 * sizeof(void*));
+   std::unique_ptr<MemoryArena> arenas[MAX_FUSE];
+   bool locked = true;
+   for (auto& arena: arenas) {
+      arena.reset(new MemoryArena(max_memsize, Backing::heap, LOCK_MEMORY));
+      locked = locked && arena->locked();
+   }
+   if (LOCK_MEMORY && !locked) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+   void** memory[MAX_FUSE];
+   void** ptrs[MAX_FUSE];
+   std::unique_ptr<PerfCounters> counters;
+#ifdef PERF_COUNTERS
+   counters.reset(new PerfCounters());
+   if (!counters->available()) {
+      std::cerr << "performance counters are not available" << std::endl;
+      counters.reset();
+   }
+#endif
+
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+   ResultTable table("fused-linear-chase", "stride", 8, "GiB/s", format);
+   if (table.text()) {
+      fmt::printf("                                          "
+	 "data access speeds in GiB/s\n");
+      print_fused_header("stride", MIN_FUSE, MAX_FUSE, counters.get());
+   }
    for (std::size_t stride = MIN_STRIDE; stride <= MAX_STRIDE;
 	 stride += sizeof(void*)) {
       size_t memsize = std::min(std::size_t{1}<<26,
 	 stride * 1024 * sizeof(void*));
-      std::size_t count = std::size_t{1}<<30;
-      fmt::printf(" %8u", stride);
-
-      auto print_result = [=](int fuse, double t) {
-	 auto volume = static_cast<double>(sizeof(void*)) * count * fuse;
-	 auto speed = volume / t / (1<<30); /* in GiB/s */
-	 fmt::printf("  %10.5lf", speed); std::cout.flush();
-      };
-
-      fused_action([=](void**& p) {
-	 p = create_linear_chain(memsize, stride);
-      }, m1, m2, m3, m4, m5, m6, m7, m8);
-      p1 = m1; p2 = m2; p3 = m3; p4 = m4;
-      p5 = m5; p6 = m6; p7 = m7; p8 = m8;
-
-      print_result(1, fused_chase(count, p1));
-      print_result(2, fused_chase(count, p1, p2));
-      print_result(3, fused_chase(count, p1, p2, p3));
-      print_result(4, fused_chase(count, p1, p2, p3, p4));
-      print_result(5, fused_chase(count, p1, p2, p3, p4, p5));
-      print_result(6, fused_chase(count, p1, p2, p3, p4, p5, p6));
-      print_result(7, fused_chase(count, p1, p2, p3, p4, p5, p6, p7));
-      print_result(8, fused_chase(count, p1, p2, p3, p4, p5, p6, p7, p8));
+      table.begin_row(stride);
 
-      fused_action([](void**& p) {
-	 delete[] p;
-      }, m1, m2, m3, m4, m5, m6, m7, m8);
+      for (std::size_t i = 0; i < MAX_FUSE; ++i) {
+	 memory[i] = arenas[i]->memory();
+	 init_linear_chain(memory[i], memsize, stride);
+      }
+      for (std::size_t fuse = MIN_FUSE; fuse <= MAX_FUSE; ++fuse) {
+	 std::copy(memory, memory + fuse, ptrs);
+	 print_fused_result(fuse, ptrs, counters.get(), table);
+      }
 
-      fmt::printf("\n"); std::cout.flush();
+      table.end_row();
    }
 }
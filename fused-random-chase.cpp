@@ -0,0 +1,119 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* this utility is an extension of the random-chase:
+   it chases n random pointer chains in an interleaved pattern
+   for n running from MIN_FUSE to MAX_FUSE; as the chains are
+   independent from each other, the number of outstanding
+   memory accesses grows with n until the memory system
+   is saturated */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "fused-chase.hpp"
+#include "perf-counters.hpp"
+#include "random-chain.hpp"
+#include "result-table.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+/* size of each of the chains */
+#ifndef MIN_SIZE
+#define MIN_SIZE (std::size_t{1}<<20)
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{64}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* range of fuse factors, at most max_fuse (32) */
+#ifndef MIN_FUSE
+#define MIN_FUSE 1
+#endif
+#ifndef MAX_FUSE
+#define MAX_FUSE 16
+#endif
+static_assert(MIN_FUSE >= 1 && MIN_FUSE <= MAX_FUSE && MAX_FUSE <= max_fuse,
+   "fuse factors must be in the range of 1 to max_fuse");
+/* if PERF_COUNTERS is defined, hardware performance counters
+   per access are given for each fuse factor where available */
+
+int main() {
+   void** memory[MAX_FUSE];
+   void** ptrs[MAX_FUSE];
+   std::unique_ptr<PerfCounters> counters;
+#ifdef PERF_COUNTERS
+   counters.reset(new PerfCounters());
+   if (!counters->available()) {
+      std::cerr << "performance counters are not available" << std::endl;
+      counters.reset();
+   }
+#endif
+
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+   ResultTable table("fused-random-chase", "memsize", 8, "GiB/s", format);
+   if (table.text()) {
+      fmt::printf("                                          "
+	 "data access speeds in GiB/s\n");
+      print_fused_header("memsize", MIN_FUSE, MAX_FUSE, counters.get());
+   }
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      table.begin_row(memsize);
+
+      /* a non-zero seed is varied per chain as chains of the
+	 same seed would visit the same offsets in lock-step */
+      for (std::size_t i = 0; i < MAX_FUSE; ++i) {
+	 memory[i] = create_random_chain(memsize, SEED? SEED + i: 0,
+	    CHAIN_THREADS);
+      }
+      for (std::size_t fuse = MIN_FUSE; fuse <= MAX_FUSE; ++fuse) {
+	 std::copy(memory, memory + fuse, ptrs);
+	 print_fused_result(fuse, ptrs, counters.get(), table);
+      }
+      for (auto m: memory) {
+	 delete[] m;
+      }
+
+      table.end_row();
+   }
+}
@@ -0,0 +1,130 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <sys/utsname.h>
+#include <unistd.h>
+#include "host-info.hpp"
+
+/* flags the utilities were compiled with,
+   passed by the Makefile */
+#ifndef COMPILE_FLAGS
+#define COMPILE_FLAGS "-"
+#endif
+
+/* read the first line of the given file, empty if not accessible */
+static std::string read_line(const std::string& path) {
+   std::ifstream in(path);
+   std::string line;
+   if (in) std::getline(in, line);
+   return line;
+}
+
+/* return the value of the first line of /proc/cpuinfo
+   with the given field name, empty if there is none */
+static std::string cpuinfo(const std::string& field) {
+   std::ifstream in("/proc/cpuinfo");
+   std::string line;
+   while (std::getline(in, line)) {
+      auto colon = line.find(':');
+      if (colon == std::string::npos || colon == 0) continue;
+      auto end = line.find_last_not_of(" \t", colon - 1);
+      if (end == std::string::npos || line.compare(0, end + 1, field)) {
+	 continue;
+      }
+      auto begin = line.find_first_not_of(" \t", colon + 1);
+      if (begin == std::string::npos) return "";
+      return line.substr(begin);
+   }
+   return "";
+}
+
+/* return the selected mode of a sysfs file like
+   "always [madvise] never", empty if not accessible */
+static std::string selected_mode(const std::string& path) {
+   std::string line = read_line(path);
+   auto begin = line.find('[');
+   auto end = line.find(']');
+   if (begin == std::string::npos || end == std::string::npos ||
+	 end < begin) {
+      return line;
+   }
+   return line.substr(begin + 1, end - begin - 1);
+}
+
+HostInfo host_info() {
+   HostInfo info;
+   auto add = [&](const char* name, const std::string& value) {
+      info.emplace_back(name, value.empty()? "-": value);
+   };
+
+   char hostname[256] = {0};
+   gethostname(hostname, sizeof hostname - 1);
+   add("host", hostname);
+   std::string cpu = cpuinfo("model name");
+   if (cpu.empty()) {
+      /* aarch64 gives just the implementer and the part number */
+      std::string implementer = cpuinfo("CPU implementer");
+      std::string part = cpuinfo("CPU part");
+      if (!implementer.empty()) cpu = implementer + "/" + part;
+   }
+   add("cpu", cpu);
+   add("cpus", std::to_string(sysconf(_SC_NPROCESSORS_ONLN)));
+   std::string cpufreq = "/sys/devices/system/cpu/cpu0/cpufreq/";
+   add("governor", read_line(cpufreq + "scaling_governor"));
+   add("max_khz", read_line(cpufreq + "scaling_max_freq"));
+   std::string boost = read_line("/sys/devices/system/cpu/cpufreq/boost");
+   if (boost.empty()) {
+      std::string no_turbo =
+	 read_line("/sys/devices/system/cpu/intel_pstate/no_turbo");
+      if (!no_turbo.empty()) boost = no_turbo == "0"? "1": "0";
+   }
+   add("boost", boost);
+   struct utsname uts;
+   if (uname(&uts) == 0) {
+      add("kernel", std::string(uts.sysname) + " " + uts.release +
+	 " " + uts.machine);
+   } else {
+      add("kernel", "");
+   }
+   std::string thp = "/sys/kernel/mm/transparent_hugepage/";
+   add("thp", selected_mode(thp + "enabled"));
+   add("thp_defrag", selected_mode(thp + "defrag"));
+   add("hugepages", read_line("/proc/sys/vm/nr_hugepages"));
+#ifdef __VERSION__
+   add("compiler", __VERSION__);
+#else
+   add("compiler", "");
+#endif
+   add("flags", COMPILE_FLAGS);
+   std::time_t now = std::time(nullptr);
+   char date[32] = {0};
+   std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ",
+      std::gmtime(&now));
+   add("date", date);
+   return info;
+}
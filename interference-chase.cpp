@@ -0,0 +1,393 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* variant of random-chase where the measuring thread shares the
+   core or the caches with an antagonist: a pointer chase, a
+   streaming load, or a cache-thrashing load with a given footprint
+   runs on the SMT sibling, on another core sharing the L2 or L3
+   cache, or on a core that shares none of the caches; for each of
+   these configurations, the effective capacities and access times
+   of all cache levels are compared with those of an idle system */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "cpu-affinity.hpp"
+#include "cpu-topology.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "memory-traffic.hpp"
+#include "random-chain.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* logical CPU of the measuring thread, -1 selects
+   the first available CPU */
+#ifndef VICTIM_CPU
+#define VICTIM_CPU (-1)
+#endif
+/* list of antagonists out of "chase", "stream", and "thrash" */
+#ifndef ANTAGONISTS
+#define ANTAGONISTS "chase stream thrash"
+#endif
+/* list of placements of the antagonist relative to the measuring
+   thread out of "smt", "l2", "l3", and "remote" */
+#ifndef PLACEMENTS
+#define PLACEMENTS "smt l3 remote"
+#endif
+/* size of the buffer of the antagonist */
+#ifndef FOOTPRINT
+#define FOOTPRINT (std::size_t{16}<<20)
+#endif
+/* parameters of the level detection, see cache-levels */
+#ifndef TOLERANCE
+#define TOLERANCE 0.15
+#endif
+#ifndef MIN_SPAN
+#define MIN_SPAN 1.5
+#endif
+#ifndef MIN_STEP
+#define MIN_STEP 1.5
+#endif
+
+enum class Antagonist {
+   chase,	/* chases a random chain */
+   stream,	/* reads its buffer sequentially */
+   thrash,	/* updates scattered lines of its buffer */
+};
+
+static const struct {
+   Antagonist antagonist;
+   const char* name;
+} antagonist_names[] = {
+   {Antagonist::chase, "chase"},
+   {Antagonist::stream, "stream"},
+   {Antagonist::thrash, "thrash"},
+};
+
+/* the placements with the relations to the measuring thread
+   in the order of preference */
+static const struct {
+   const char* name;
+   std::vector<CpuRelation> relations;
+} placement_names[] = {
+   {"smt", {CpuRelation::smt}},
+   {"l2", {CpuRelation::l2}},
+   {"l3", {CpuRelation::l3}},
+   {"remote", {CpuRelation::die, CpuRelation::package, CpuRelation::remote}},
+};
+
+/* split a blank- or comma-separated list */
+std::vector<std::string> split(const char* names) {
+   std::vector<std::string> list;
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 list.emplace_back(names, len);
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return list;
+}
+
+/* run the antagonist on the given CPU until stop becomes true
+   where ready is set as soon as its buffer is initialized */
+/* state of an antagonist as seen by the measuring thread */
+enum class AntagonistState {starting, running, unpinned};
+
+void run_antagonist(Antagonist antagonist, unsigned int cpu,
+      std::atomic<bool>& stop, std::atomic<AntagonistState>& state) {
+   /* an antagonist that runs anywhere else
+      would not match its placement */
+   if (!pin_thread(cpu)) {
+      state.store(AntagonistState::unpinned);
+      return;
+   }
+   /* the buffer is allocated and touched after pinning
+      such that it is local to the antagonist */
+   std::atomic<std::size_t> bytes{0};
+   std::atomic<unsigned int> delay{0};
+   switch (antagonist) {
+      case Antagonist::chase: {
+	    void** memory = create_random_chain(FOOTPRINT,
+	       SEED, CHAIN_THREADS);
+	    state.store(AntagonistState::running);
+	    while (!stop.load(std::memory_order_relaxed)) {
+	       chase_pointers(memory, std::size_t{1}<<16);
+	    }
+	    delete[] memory;
+	 }
+	 break;
+      case Antagonist::stream: {
+	    char* buffer = new char[FOOTPRINT]();
+	    state.store(AntagonistState::running);
+	    generate_traffic(buffer, FOOTPRINT, 1, 0, delay, stop, bytes);
+	    delete[] buffer;
+	 }
+	 break;
+      case Antagonist::thrash: {
+	    char* buffer = new char[FOOTPRINT]();
+	    state.store(AntagonistState::running);
+	    thrash_cache(buffer, FOOTPRINT, stop, bytes);
+	    delete[] buffer;
+	 }
+	 break;
+   }
+}
+
+/* measurement configuration; an idle system if cpu < 0 */
+struct Configuration {
+   std::string name;
+   int cpu;
+   Antagonist antagonist;
+};
+
+int main() {
+   auto cpus = available_cpus();
+   int victim = VICTIM_CPU;
+   if (victim < 0) victim = cpus.front();
+   if (!pin_thread(victim)) {
+      std::cerr << "unable to pin to CPU " << victim << std::endl;
+      std::exit(1);
+   }
+   auto location = cpu_location(victim);
+
+   std::vector<Antagonist> antagonists;
+   for (auto& name: split(ANTAGONISTS)) {
+      bool found = false;
+      for (auto& entry: antagonist_names) {
+	 if (name == entry.name) {
+	    antagonists.push_back(entry.antagonist);
+	    found = true; break;
+	 }
+      }
+      if (!found) {
+	 std::cerr << "invalid list of antagonists: " << ANTAGONISTS <<
+	    std::endl;
+	 std::exit(1);
+      }
+   }
+
+   /* the idle system followed by all combinations of placements
+      and antagonists for which a CPU is found */
+   std::vector<Configuration> configurations;
+   configurations.push_back(Configuration{"idle", -1, Antagonist::chase});
+   for (auto& name: split(PLACEMENTS)) {
+      auto placement = std::find_if(std::begin(placement_names),
+	 std::end(placement_names),
+	 [&](decltype(placement_names[0])& entry) {
+	    return name == entry.name;
+	 });
+      if (placement == std::end(placement_names)) {
+	 std::cerr << "invalid list of placements: " << PLACEMENTS <<
+	    std::endl;
+	 std::exit(1);
+      }
+      int cpu = -1;
+      for (auto relation: placement->relations) {
+	 for (auto candidate: cpus) {
+	    if (cpu_relation(location, cpu_location(candidate)) ==
+		  relation) {
+	       cpu = candidate; break;
+	    }
+	 }
+	 if (cpu >= 0) break;
+      }
+      if (cpu < 0) {
+	 std::cerr << "no CPU available for placement " << name <<
+	    std::endl;
+	 continue;
+      }
+      for (auto antagonist: antagonists) {
+	 std::string antagonist_name;
+	 for (auto& entry: antagonist_names) {
+	    if (entry.antagonist == antagonist) antagonist_name = entry.name;
+	 }
+	 configurations.push_back(Configuration{name + "/" + antagonist_name,
+	    cpu, antagonist});
+      }
+   }
+
+   MemoryArena arena(MAX_SIZE, Backing::heap, LOCK_MEMORY);
+   if (LOCK_MEMORY && !arena.locked()) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+   std::vector<std::size_t> sizes;
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      sizes.push_back(memsize);
+   }
+
+   /* one sweep per configuration while its antagonist is running;
+      the sweep remains empty if the antagonist could not be pinned */
+   std::vector<std::vector<Sample>> samples;
+   for (auto& configuration: configurations) {
+      std::atomic<bool> stop{false};
+      std::atomic<AntagonistState> state{AntagonistState::starting};
+      std::thread thread;
+      if (configuration.cpu >= 0) {
+	 thread = std::thread(run_antagonist, configuration.antagonist,
+	    configuration.cpu, std::ref(stop), std::ref(state));
+	 while (state.load() == AntagonistState::starting) {
+	    std::this_thread::yield();
+	 }
+	 if (state.load() == AntagonistState::unpinned) {
+	    std::cerr << "unable to pin antagonist " << configuration.name <<
+	       " to CPU " << configuration.cpu << std::endl;
+	    thread.join();
+	    samples.emplace_back();
+	    continue;
+	 }
+      }
+      std::vector<Sample> sweep;
+      for (auto memsize: sizes) {
+	 void** memory = arena.memory();
+	 init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+	 auto stats = measure([=](std::size_t count) {
+	    return chase_pointers(memory, count);
+	 }, measurement_parameters());
+	 sweep.push_back(Sample{memsize, stats.median});
+      }
+      stop.store(true);
+      if (thread.joinable()) thread.join();
+      samples.push_back(sweep);
+   }
+
+   fmt::printf("# measuring on CPU %d, antagonists on", victim);
+   for (std::size_t i = 1; i < configurations.size(); ++i) {
+      fmt::printf(" %s: %d", configurations[i].name, configurations[i].cpu);
+   }
+   fmt::printf("\n\n%14s%s\n", "",
+      "  ns per access with the given antagonist");
+   fmt::printf("       memsize");
+   for (auto& configuration: configurations) {
+      fmt::printf("  %14s", configuration.name);
+   }
+   fmt::printf("\n");
+   for (std::size_t k = 0; k < sizes.size(); ++k) {
+      fmt::printf(" %13u", sizes[k]);
+      for (auto& sweep: samples) {
+	 if (sweep.empty()) {
+	    fmt::printf("  %14s", "-");
+	 } else {
+	    fmt::printf("  %14.5lf", sweep[k].ns);
+	 }
+      }
+      fmt::printf("\n");
+   }
+
+   /* each level of the idle system is matched with the level of
+      a configuration whose range of sizes overlaps it most;
+      if this is main memory, i.e. it begins beyond the last level
+      cache, the cache level has effectively vanished */
+   std::size_t llc_size = last_level_cache_size();
+   std::vector<std::vector<Level>> levels;
+   std::vector<std::size_t> caches;
+   for (auto& sweep: samples) {
+      levels.push_back(detect_levels(sweep, TOLERANCE, MIN_SPAN, MIN_STEP));
+      caches.push_back(cache_levels(levels.back(), llc_size));
+   }
+   auto& idle = levels.front();
+   if (idle.empty()) {
+      fmt::printf("\n# no levels detected\n");
+      return 0;
+   }
+   fmt::printf("\n%46s%s\n", "", "relative to idle in %");
+   fmt::printf("    antagonist  level        capacity  time in ns"
+      "    capacity        time\n");
+   for (std::size_t c = 0; c < configurations.size(); ++c) {
+      for (std::size_t i = 0; i < idle.size(); ++i) {
+	 std::size_t best = levels[c].size();
+	 std::size_t best_overlap = 0;
+	 for (std::size_t j = 0; j < levels[c].size(); ++j) {
+	    std::size_t overlap = 0;
+	    for (auto memsize: sizes) {
+	       if (memsize >= idle[i].first && memsize <= idle[i].last &&
+		     memsize >= levels[c][j].first &&
+		     memsize <= levels[c][j].last) {
+		  ++overlap;
+	       }
+	    }
+	    if (overlap > best_overlap) {
+	       best = j; best_overlap = overlap;
+	    }
+	 }
+	 fmt::printf(" %13s", i == 0? configurations[c].name: "");
+	 if (i < caches[0]) {
+	    fmt::printf("     L%u", i + 1);
+	 } else {
+	    fmt::printf("   DRAM");
+	 }
+	 if (best == levels[c].size()) {
+	    fmt::printf("  %14s  %10s  %10s  %10s\n", "-", "-", "-", "-");
+	    continue;
+	 }
+	 auto& level = levels[c][best];
+	 bool cache = i < caches[0] && best < caches[c];
+	 if (cache) {
+	    fmt::printf("  %14u", level.last);
+	 } else {
+	    fmt::printf("  %14s", "-");
+	 }
+	 fmt::printf("  %10.5lf", level.ns);
+	 if (cache) {
+	    fmt::printf("  %10.1lf", 100.0 * level.last / idle[i].last);
+	 } else if (i < caches[0]) {
+	    fmt::printf("  %10.1lf", 0.0);
+	 } else {
+	    fmt::printf("  %10s", "-");
+	 }
+	 fmt::printf("  %10.1lf\n", 100.0 * level.ns / idle[i].ns);
+      }
+   }
+}
@@ -0,0 +1,60 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cmath>
+#include "latency-histogram.hpp"
+
+LatencyHistogram::LatencyHistogram(unsigned int subbuckets) :
+      subbuckets(subbuckets), total(0) {
+}
+
+void LatencyHistogram::add(double value) {
+   std::size_t index = 0;
+   if (value >= 1) {
+      index = 1 + static_cast<std::size_t>(std::log2(value) * subbuckets);
+   }
+   if (index >= buckets.size()) buckets.resize(index + 1);
+   ++buckets[index]; ++total;
+}
+
+double LatencyHistogram::percentile(double percentile) const {
+   if (total == 0) return 0;
+   /* rank of the requested sample, counting from 1 */
+   double rank = std::ceil(percentile / 100 * total);
+   if (rank < 1) rank = 1;
+   std::size_t sum = 0;
+   for (std::size_t index = 0; index < buckets.size(); ++index) {
+      sum += buckets[index];
+      if (sum >= rank) {
+	 if (index == 0) return 0.5;
+	 return std::exp2((index - 0.5) / subbuckets);
+      }
+   }
+   return std::exp2((buckets.size() - 1.5) / subbuckets);
+}
+
+void LatencyHistogram::clear() {
+   buckets.clear(); total = 0;
+}
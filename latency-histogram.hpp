@@ -0,0 +1,50 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <cstddef>
+#include <vector>
+
+/* histogram with logarithmic buckets where each power of two
+   is split into a fixed number of sub-buckets;
+   values below 1 are collected in the first bucket */
+class LatencyHistogram {
+   public:
+      LatencyHistogram(unsigned int subbuckets = 8);
+      void add(double value);
+      std::size_t count() const { return total; }
+      /* return the geometric center of the bucket that contains
+	 the given percentile, 0 <= percentile <= 100 */
+      double percentile(double percentile) const;
+      void clear();
+   private:
+      unsigned int subbuckets;
+      std::vector<std::size_t> buckets;
+      std::size_t total;
+};
+
+#endif
@@ -29,7 +29,7 @@
    where the lowest significant bit has index 0,
    i.e. return minimal n where 2^(n+1) > val
 */
-static unsigned int log2(unsigned int val) {
+static unsigned int log2(std::size_t val) {
    unsigned int count = 0;
    while (val >>= 1) {
       ++count;
@@ -38,8 +38,8 @@ static unsigned int log2(unsigned int val) {
 }
 
 /* reverse the given number of bits within val */
-static unsigned int bit_reverse(unsigned int val, unsigned int bits) {
-   unsigned int result = 0;
+static std::size_t bit_reverse(std::size_t val, unsigned int bits) {
+   std::size_t result = 0;
    while (bits > 0) {
       result = (result << 1) | (val & 1);
       val >>= 1;
@@ -49,28 +49,28 @@ static unsigned int bit_reverse(unsigned int val, unsigned int bits) {
 }
 
 /* generate a bit-reversal permutation; see https://oeis.org/A030109 */
-static void gen_bit_reversal_permutation(unsigned int* seq,
-      unsigned int bits, unsigned int count) {
+static void gen_bit_reversal_permutation(std::size_t* seq,
+      unsigned int bits, std::size_t count) {
    /* generate a bit-reversal permutation for integers from 0 to (2^bits)-1 */
-   unsigned int maxval = 1<<bits;
-   for (unsigned int val = 0; val < maxval; ++val) {
+   std::size_t maxval = std::size_t{1}<<bits;
+   for (std::size_t val = 0; val < maxval; ++val) {
       seq[val] = bit_reverse(val, bits);
    }
    /* cut sequence short if count is not a power of 2, i.e. count < 2^bits */
-   unsigned int current = maxval;
-   unsigned int index = 0;
+   std::size_t current = maxval;
+   std::size_t index = 0;
    while (current > count) {
       while (seq[index] < count) ++index;
       --current; seq[index] = seq[current];
    }
 }
 
-/* create a cyclic pointer chain where the individual locations
-   are stride bytes apart */
-void** create_linear_chain(std::size_t size, std::size_t stride) {
-   std::size_t len = size / sizeof(void*);
-   void** memory = new void*[len];
-
+/* fill the given memory section with a cyclic pointer chain
+   where the individual elements of the given number of words
+   are stride bytes apart and the first word of each element
+   points to the next element */
+static void init_chain(void** memory, std::size_t size, std::size_t stride,
+      unsigned int words) {
    /* if we have multiple runs through the same buffer
       make sure that we operate with offsets where it appears
       more likely that the associated lines are not yet in
@@ -80,27 +80,64 @@ void** create_linear_chain(std::size_t size, std::size_t stride) {
 
 	 0 4 2 6 1 5 3 7
    */
-   unsigned int runs = stride / sizeof(void*);
+   std::size_t runs = stride / (words * sizeof(void*));
    unsigned int bits = log2(runs);
-   if ((1<<bits) != runs) ++bits;
-   unsigned int* offset = new unsigned int[1<<bits];
+   if ((std::size_t{1}<<bits) != runs) ++bits;
+   std::size_t* offset = new std::size_t[std::size_t{1}<<bits];
    gen_bit_reversal_permutation(offset, bits, runs);
 
    /* generate the actual pointer chain */
-   unsigned int run = 0;
    void** last = nullptr;
-   for (unsigned int run = 0; run < runs; ++run) {
-      char* next = (char*) memory + offset[run] * sizeof(void*);
+   for (std::size_t run = 0; run < runs; ++run) {
+      char* next = (char*) memory + offset[run] * words * sizeof(void*);
       if (last) {
 	 *last = (void*) next;
       }
       last = (void**) next;
       for(;;) {
 	 char* next = (char*) last + stride;
-	 if (next >= (char*) memory + size) break;
+	 if (next + words * sizeof(void*) > (char*) memory + size) break;
 	 *last = (void*) next; last = (void**) next;
       }
    }
    *last = (void*) memory; /* close the cycle */
+   delete[] offset;
+}
+
+void init_linear_chain(void** memory, std::size_t size, std::size_t stride) {
+   init_chain(memory, size, stride, 1);
+}
+
+void init_lookahead_chain(void** memory, std::size_t size,
+      std::size_t stride, std::size_t distance) {
+   init_chain(memory, size, stride, 2);
+   set_lookahead(memory, distance);
+}
+
+void set_lookahead(void** memory, std::size_t distance) {
+   void** ahead = memory;
+   for (std::size_t i = 0; i < distance; ++i) {
+      ahead = (void**) *ahead;
+   }
+   void** p = memory;
+   do {
+      p[1] = (void*) ahead;
+      ahead = (void**) *ahead;
+      p = (void**) *p;
+   } while (p != memory);
+}
+
+/* create a cyclic pointer chain where the individual locations
+   are stride bytes apart */
+void** create_linear_chain(std::size_t size, std::size_t stride) {
+   void** memory = new void*[size / sizeof(void*)];
+   init_linear_chain(memory, size, stride);
+   return memory;
+}
+
+void** create_linear_chain(std::size_t size, std::size_t stride,
+      Backing backing) {
+   void** memory = (void**) allocate_buffer(size, backing);
+   if (memory) init_linear_chain(memory, size, stride);
    return memory;
 }
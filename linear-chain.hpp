@@ -27,6 +27,23 @@
 #define LINEAR_CHAIN_HPP
 
 #include <cstddef>
+#include "memory-backing.hpp"
+
+/* fill the given memory section of the given size with a cyclic
+   pointer chain where the individual locations are stride bytes apart */
+void init_linear_chain(void** memory, std::size_t size, std::size_t stride);
+
+/* like init_linear_chain but for elements of two words where
+   the first word points to the next element and the second word
+   to the element that follows distance elements later, such that
+   it can be prefetched in time;
+   stride must be a multiple of two words */
+void init_lookahead_chain(void** memory, std::size_t size,
+   std::size_t stride, std::size_t distance);
+
+/* change the distance of the second words of a chain that
+   has been initialized by init_lookahead_chain */
+void set_lookahead(void** memory, std::size_t distance);
 
 /* create a cyclic pointer chain where the individual locations
    are stride bytes apart;
@@ -37,4 +54,10 @@
 */
 void** create_linear_chain(std::size_t size, std::size_t stride);
 
+/* likewise but for a memory section with the given backing
+   which is to be released using free_buffer;
+   nullptr is returned if the backing is not available */
+void** create_linear_chain(std::size_t size, std::size_t stride,
+   Backing backing);
+
 #endif
@@ -30,11 +30,17 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <unistd.h>
 #include <sys/times.h>
 #include <printf.hpp> /* see https://github.com/afborchert/fmt */
 #include "chase-pointers.hpp"
 #include "linear-chain.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "perf-counters.hpp"
+#include "result-table.hpp"
+#include "utility-config.hpp"
 
 #ifndef MIN_STRIDE
 #define MIN_STRIDE (sizeof(void*))
@@ -42,18 +48,77 @@
 #ifndef MAX_STRIDE
 #define MAX_STRIDE 1200
 #endif
+/* if SUBTRACT_OVERHEAD is defined, the overhead of the unrolled
+   loop, as measured by an empty loop, is subtracted from the median
+   and the minimum */
+/* if PERF_COUNTERS is defined, hardware performance counters
+   per access are given for each stride where available */
 
 int main() {
-   fmt::printf("   stride  time in ns\n");
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+   std::unique_ptr<PerfCounters> counters;
+#ifdef PERF_COUNTERS
+   counters.reset(new PerfCounters());
+   if (!counters->available()) {
+      std::cerr << "performance counters are not available" << std::endl;
+      counters.reset();
+   }
+#endif
+   std::size_t nof_counters = counters? counters->size(): 0;
+   ChaseKernel chase = chase_kernel(UNROLL);
+   double overhead = 0;
+#ifdef SUBTRACT_OVERHEAD
+   overhead = measure([](std::size_t count) {
+      return chase_loop_overhead(count, UNROLL);
+   }, measurement_parameters()).median;
+#endif
+
+   /* a single arena suffices for the largest chain */
+   MemoryArena arena(std::min(std::size_t{1}<<26,
+      std::size_t{MAX_STRIDE} * 1024 * sizeof(void*)),
+      Backing::heap, LOCK_MEMORY);
+   if (LOCK_MEMORY && !arena.locked()) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+
+   ResultTable table("linear-chase", "stride", 8, "ns", format);
+   if (table.text()) {
+      fmt::printf("   stride      median         min      stddev");
+      for (std::size_t j = 0; j < nof_counters; ++j) {
+	 fmt::printf("  %10s", counters->name(j));
+      }
+      fmt::printf("\n");
+   }
    for (std::size_t stride = MIN_STRIDE; stride <= MAX_STRIDE;
 	 stride += sizeof(void*)) {
       size_t memsize = std::min(std::size_t{1}<<26,
 	 stride * 1024 * sizeof(void*));
-      void** memory = create_linear_chain(memsize, stride);
-      std::size_t count = std::size_t{1}<<30;
-      double t = chase_pointers(memory, count);
-      delete[] memory;
-      double ns = t * 1000000000 / count;
-      fmt::printf(" %8u  %10.5lf\n", stride, ns); std::cout.flush();
+      void** memory = arena.memory();
+      init_linear_chain(memory, memsize, stride);
+      if (counters) counters->reset();
+      std::size_t accesses = 0;
+      auto stats = measure([=, &counters, &accesses](std::size_t count) {
+	 accesses += count;
+	 return chase(memory, count, counters.get());
+      }, measurement_parameters());
+      stats.median -= overhead;
+      stats.min -= overhead;
+      table.begin_row(stride);
+      table.add("", "median", stats.median);
+      table.add("", "min", stats.min);
+      table.add("", "stddev", stats.stddev);
+      for (std::size_t j = 0; j < nof_counters; ++j) {
+	 if (counters->scheduled()) {
+	    table.add("", counters->name(j), counters->value(j) / accesses,
+	       "per access");
+	 } else {
+	    table.add_missing("", counters->name(j), "per access");
+	 }
+      }
+      table.end_row();
    }
 }
@@ -0,0 +1,145 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* loaded-latency variant of random-chase:
+   one pinned thread measures the average read access time of a
+   randomized pointer chain while a number of pinned load threads
+   generate streaming traffic on their own buffers;
+   the injection rate of the load threads is ramped up step by step
+   such that we get the latency in dependence of the achieved
+   aggregate bandwidth */
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "cpu-affinity.hpp"
+#include "memory-traffic.hpp"
+#include "random-chain.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+/* size of the randomized chain of the latency-measuring thread */
+#ifndef MEMSIZE
+#define MEMSIZE (std::size_t{1}<<28)
+#endif
+/* size of the buffer of each load thread */
+#ifndef LOAD_SIZE
+#define LOAD_SIZE (std::size_t{1}<<27)
+#endif
+/* number of load threads, 0 selects one per remaining CPU */
+#ifndef LOAD_THREADS
+#define LOAD_THREADS 0
+#endif
+/* ratio of read and written cache lines of the load threads */
+#ifndef LOAD_READS
+#define LOAD_READS 1
+#endif
+#ifndef LOAD_WRITES
+#define LOAD_WRITES 0
+#endif
+/* initial delay per cache line which is halved for each row */
+#ifndef MAX_DELAY
+#define MAX_DELAY 8192
+#endif
+/* number of pointers to be chased for each row */
+#ifndef COUNT
+#define COUNT (std::size_t{1}<<25)
+#endif
+
+int main() {
+   auto cpus = available_cpus();
+   pin_thread(cpus[0]);
+   unsigned int nof_threads = LOAD_THREADS;
+   if (nof_threads == 0) nof_threads = cpus.size() - 1;
+   if (nof_threads >= cpus.size()) {
+      /* the load threads must not share the measuring CPU */
+      std::cerr << "LOAD_THREADS must be less than the number of "
+	 "available CPUs (" << cpus.size() << ")" << std::endl;
+      return 1;
+   }
+
+   void** memory = create_random_chain(MEMSIZE, SEED, CHAIN_THREADS);
+   std::size_t count = COUNT;
+
+   fmt::printf("    delay  bandwidth in GiB/s  latency in ns\n");
+   double t = chase_pointers(memory, count);
+   fmt::printf("     idle  %18.5lf  %13.5lf\n",
+      0.0, t * 1000000000 / count); std::cout.flush();
+
+   std::atomic<bool> stop{false};
+   std::atomic<unsigned int> delay{MAX_DELAY};
+   std::atomic<unsigned int> ready{0};
+   std::atomic<std::size_t>* bytes =
+      new std::atomic<std::size_t>[nof_threads];
+   std::thread* threads = new std::thread[nof_threads];
+   for (unsigned int i = 0; i < nof_threads; ++i) {
+      bytes[i].store(0);
+      unsigned int cpu = cpus[i + 1];
+      threads[i] = std::thread([=, &stop, &delay, &ready]() {
+	 pin_thread(cpu);
+	 /* allocate and touch the buffer after pinning
+	    such that it is local to the load thread */
+	 char* buffer = new char[LOAD_SIZE]();
+	 ++ready;
+	 generate_traffic(buffer, LOAD_SIZE, LOAD_READS, LOAD_WRITES,
+	    delay, stop, bytes[i]);
+	 delete[] buffer;
+      });
+   }
+   while (ready.load() < nof_threads) {
+      std::this_thread::yield();
+   }
+
+   auto transferred = [=]() {
+      std::size_t sum = 0;
+      for (unsigned int i = 0; i < nof_threads; ++i) {
+	 sum += bytes[i].load(std::memory_order_relaxed);
+      }
+      return sum;
+   };
+   for (unsigned int d = MAX_DELAY; nof_threads > 0; d /= 2) {
+      delay.store(d);
+      std::size_t before = transferred();
+      WallTime<double> walltime;
+      double t = chase_pointers(memory, count);
+      double elapsed = walltime.elapsed();
+      std::size_t after = transferred();
+      double bandwidth = (after - before) / elapsed / (1<<30);
+      fmt::printf(" %8u  %18.5lf  %13.5lf\n",
+	 d, bandwidth, t * 1000000000 / count); std::cout.flush();
+      if (d == 0) break;
+   }
+
+   stop.store(true);
+   for (unsigned int i = 0; i < nof_threads; ++i) {
+      threads[i].join();
+   }
+   delete[] threads;
+   delete[] bytes;
+   delete[] memory;
+}
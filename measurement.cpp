@@ -0,0 +1,105 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "measurement.hpp"
+#include "walltime.hpp"
+
+/* return the median of the given values */
+static double median(std::vector<double> values) {
+   std::sort(values.begin(), values.end());
+   std::size_t n = values.size();
+   if (n % 2) return values[n/2];
+   return (values[n/2 - 1] + values[n/2]) / 2;
+}
+
+/* compute the statistics of the given samples after
+   the rejection of outliers */
+static Statistics evaluate(const std::vector<double>& samples,
+      double outlier_factor) {
+   double med = median(samples);
+   std::vector<double> deviations;
+   for (auto sample: samples) {
+      deviations.push_back(std::fabs(sample - med));
+   }
+   /* scale the MAD such that it estimates the standard deviation
+      of normally distributed samples */
+   double mad = 1.4826 * median(deviations);
+   std::vector<double> accepted;
+   for (auto sample: samples) {
+      if (std::fabs(sample - med) <= outlier_factor * mad) {
+	 accepted.push_back(sample);
+      }
+   }
+   if (accepted.empty()) accepted = samples;
+
+   Statistics stats{};
+   stats.samples = accepted.size();
+   stats.rejected = samples.size() - accepted.size();
+   stats.median = median(accepted);
+   stats.min = *std::min_element(accepted.begin(), accepted.end());
+   stats.max = *std::max_element(accepted.begin(), accepted.end());
+   double sum = 0;
+   for (auto sample: accepted) sum += sample;
+   stats.mean = sum / accepted.size();
+   double sq = 0;
+   for (auto sample: accepted) {
+      sq += (sample - stats.mean) * (sample - stats.mean);
+   }
+   stats.stddev = accepted.size() > 1?
+      std::sqrt(sq / (accepted.size() - 1)): 0;
+   return stats;
+}
+
+Statistics measure(const std::function<double(std::size_t)>& run,
+      const MeasurementParameters& params) {
+   WallTime<double> walltime;
+
+   /* calibrate the number of iterations per sample */
+   std::size_t count = 1024;
+   while (run(count) < params.sample_time && count < (std::size_t{1}<<40)) {
+      count *= 2;
+   }
+   for (unsigned int i = 0; i < params.warmups; ++i) {
+      run(count);
+   }
+
+   std::vector<double> samples;
+   Statistics stats{};
+   for(;;) {
+      samples.push_back(run(count) * 1000000000 / count);
+      if (samples.size() < params.min_samples) continue;
+      stats = evaluate(samples, params.outlier_factor);
+      /* half width of the 95% confidence interval of the mean */
+      double half_width = 1.96 * stats.stddev / std::sqrt(stats.samples);
+      if (half_width <= params.confidence * stats.mean) break;
+      if (samples.size() >= params.max_samples) break;
+      if (walltime.elapsed() >= params.time_budget) break;
+   }
+   stats.count = count;
+   return stats;
+}
@@ -0,0 +1,82 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef MEASUREMENT_HPP
+#define MEASUREMENT_HPP
+
+#include <cstddef>
+#include <functional>
+
+/* defaults of the parameters of the measurement harness */
+namespace chase_defaults {
+   /* minimal duration of one sample in seconds */
+   constexpr double sample_time = 0.01;
+   /* number of samples that are dropped before the measurement */
+   constexpr unsigned int warmups = 2;
+   constexpr std::size_t min_samples = 5;
+   constexpr std::size_t max_samples = 200;
+   /* target for the half width of the 95% confidence interval
+      of the mean relative to the mean */
+   constexpr double confidence = 0.005;
+   /* time budget for one measurement in seconds */
+   constexpr double time_budget = 2.0;
+   /* samples that deviate by more than this factor times the
+      normalized median absolute deviation from the median
+      are rejected as outliers */
+   constexpr double outlier_factor = 3.0;
+} // namespace chase_defaults
+
+struct MeasurementParameters {
+   double sample_time = chase_defaults::sample_time;
+   unsigned int warmups = chase_defaults::warmups;
+   std::size_t min_samples = chase_defaults::min_samples;
+   std::size_t max_samples = chase_defaults::max_samples;
+   double confidence = chase_defaults::confidence;
+   double time_budget = chase_defaults::time_budget;
+   double outlier_factor = chase_defaults::outlier_factor;
+};
+
+/* statistics in ns per iteration of the accepted samples */
+struct Statistics {
+   double median;
+   double min;
+   double max;
+   double mean;
+   double stddev;
+   std::size_t samples;		/* number of accepted samples */
+   std::size_t rejected;	/* number of rejected outliers */
+   std::size_t count;		/* number of iterations per sample */
+};
+
+/* measure the time per iteration where run(count) performs
+   count iterations and returns the time spent in seconds;
+   count is calibrated such that a sample takes at least
+   sample_time seconds, then we warm up and repeat the samples
+   until the confidence interval is narrow enough, the time budget
+   is exhausted or max_samples is reached */
+Statistics measure(const std::function<double(std::size_t)>& run,
+   const MeasurementParameters& params = MeasurementParameters());
+
+#endif
@@ -0,0 +1,53 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <new>
+#include <sys/mman.h>
+#include "memory-arena.hpp"
+
+MemoryArena::MemoryArena(std::size_t capacity, Backing backing, bool lock) :
+      nof_bytes(capacity), kind(backing),
+      buffer(allocate_buffer(capacity, backing, true)), is_locked(false),
+      used(0) {
+   /* locking may fail due to RLIMIT_MEMLOCK in which case
+      we have to live with pages that could be swapped out */
+   if (buffer && lock) {
+      is_locked = mlock(buffer, capacity) == 0;
+   }
+}
+
+MemoryArena::~MemoryArena() {
+   if (is_locked) munlock(buffer, nof_bytes);
+   free_buffer(buffer, nof_bytes, kind);
+}
+
+void* MemoryArena::allocate(std::size_t size, std::size_t alignment) {
+   std::size_t offset = (used + alignment - 1) / alignment * alignment;
+   if (!buffer || offset > nof_bytes || size > nof_bytes - offset) {
+      throw std::bad_alloc();
+   }
+   used = offset + size;
+   return (char*) buffer + offset;
+}
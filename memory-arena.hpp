@@ -0,0 +1,77 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef MEMORY_ARENA_HPP
+#define MEMORY_ARENA_HPP
+
+#include <cstddef>
+#include "memory-backing.hpp"
+
+namespace chase_defaults {
+   /* arenas are not locked into memory by default as this
+      may require to raise RLIMIT_MEMLOCK (ulimit -l) */
+   constexpr bool lock_memory = false;
+} // namespace chase_defaults
+
+/* buffer of a fixed capacity that is allocated once with all its
+   pages faulted in and optionally locked into memory such that
+   it can be reused for chains of all sizes up to its capacity;
+   this saves the allocation for each size of a sweep and lets
+   all sizes operate on the same physical pages */
+class MemoryArena {
+   public:
+      MemoryArena(std::size_t capacity, Backing backing = Backing::heap,
+	 bool lock = chase_defaults::lock_memory);
+      ~MemoryArena();
+      MemoryArena(const MemoryArena&) = delete;
+      MemoryArena& operator=(const MemoryArena&) = delete;
+
+      /* false if the backing is not available */
+      bool available() const { return buffer != nullptr; }
+      /* true if locking was requested and succeeded */
+      bool locked() const { return is_locked; }
+      std::size_t capacity() const { return nof_bytes; }
+      Backing backing() const { return kind; }
+
+      /* return the beginning of the arena;
+	 chains of any size up to the capacity can be placed there */
+      void** memory() const { return (void**) buffer; }
+
+      /* allocate size bytes with the given alignment behind all
+	 previous allocations; std::bad_alloc is thrown if the
+	 capacity is exhausted */
+      void* allocate(std::size_t size, std::size_t alignment);
+      /* release all allocations at once */
+      void reset() { used = 0; }
+
+   private:
+      std::size_t nof_bytes;
+      Backing kind;
+      void* buffer;
+      bool is_locked;
+      std::size_t used;
+};
+
+#endif
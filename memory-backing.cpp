@@ -0,0 +1,170 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "memory-backing.hpp"
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+static const struct {
+   Backing backing;
+   const char* name;
+} backing_names[] = {
+   {Backing::heap, "heap"},
+   {Backing::pages, "4k"},
+   {Backing::thp, "thp"},
+   {Backing::huge2m, "2m"},
+   {Backing::huge1g, "1g"},
+};
+
+const char* backing_name(Backing backing) {
+   for (auto& entry: backing_names) {
+      if (entry.backing == backing) return entry.name;
+   }
+   return "?";
+}
+
+bool parse_backings(const char* names, std::vector<Backing>& backings) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 for (auto& entry: backing_names) {
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       backings.push_back(entry.backing);
+	       found = true; break;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+std::size_t physical_memory() {
+   long pages = sysconf(_SC_PHYS_PAGES);
+   long page_size = sysconf(_SC_PAGESIZE);
+   if (pages <= 0 || page_size <= 0) return 0;
+   return std::size_t(pages) * std::size_t(page_size);
+}
+
+std::size_t backing_page_size(Backing backing) {
+   switch (backing) {
+      case Backing::thp:
+      case Backing::huge2m:
+	 return std::size_t{1}<<21;
+      case Backing::huge1g:
+	 return std::size_t{1}<<30;
+      default:
+	 return std::size_t{1}<<12;
+   }
+}
+
+/* round size up to the next multiple of the page size of the backing */
+static std::size_t mapping_size(std::size_t size, Backing backing) {
+   std::size_t page_size = backing_page_size(backing);
+   return (size + page_size - 1) / page_size * page_size;
+}
+
+/* touch one word per page to fault in all pages of the buffer */
+static void touch_pages(void* buffer, std::size_t size) {
+   volatile char* p = (volatile char*) buffer;
+   for (std::size_t offset = 0; offset < size; offset += 1<<12) {
+      p[offset] = 0;
+   }
+}
+
+void* allocate_buffer(std::size_t size, Backing backing, bool populate) {
+   if (backing == Backing::heap) {
+      void** buffer = new void*[size / sizeof(void*)];
+      if (populate) touch_pages(buffer, size);
+      return buffer;
+   }
+   std::size_t len = mapping_size(size, backing);
+   int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+   if (backing == Backing::huge2m) {
+      flags |= MAP_HUGETLB | MAP_HUGE_2MB;
+   } else if (backing == Backing::huge1g) {
+      flags |= MAP_HUGETLB | MAP_HUGE_1GB;
+   } else if (backing == Backing::thp) {
+      /* over-allocate to be able to align the buffer
+	 at a huge page boundary */
+      len += backing_page_size(backing);
+   }
+   /* other mappings are populated after madvise as
+      their page size would be settled otherwise */
+   if (populate && (flags & MAP_HUGETLB)) {
+      flags |= MAP_POPULATE;
+   }
+   void* buffer = mmap(nullptr, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+   if (buffer == MAP_FAILED) return nullptr;
+   if (backing == Backing::thp) {
+      std::size_t page_size = backing_page_size(backing);
+      std::uintptr_t start = (std::uintptr_t) buffer;
+      std::uintptr_t aligned = (start + page_size - 1) / page_size * page_size;
+      std::size_t head = aligned - start;
+      std::size_t tail = page_size - head;
+      if (head) munmap(buffer, head);
+      if (tail) munmap((char*) aligned + len - page_size, tail);
+      buffer = (void*) aligned;
+      len -= page_size;
+      if (madvise(buffer, len, MADV_HUGEPAGE) != 0) {
+	 munmap(buffer, len); return nullptr;
+      }
+   } else if (backing == Backing::pages) {
+      /* failure is acceptable here as it just means that
+	 transparent huge pages are not supported */
+      madvise(buffer, len, MADV_NOHUGEPAGE);
+   }
+   if (populate && !(flags & MAP_HUGETLB)) {
+      touch_pages(buffer, len);
+   }
+   return buffer;
+}
+
+void free_buffer(void* buffer, std::size_t size, Backing backing) {
+   if (!buffer) return;
+   if (backing == Backing::heap) {
+      delete[] (void**) buffer;
+   } else {
+      munmap(buffer, mapping_size(size, backing));
+   }
+}
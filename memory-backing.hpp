@@ -0,0 +1,65 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef MEMORY_BACKING_HPP
+#define MEMORY_BACKING_HPP
+
+#include <cstddef>
+#include <vector>
+
+/* the kind of memory a chain buffer is backed by */
+enum class Backing {
+   heap,	/* new[], whatever the allocator and the kernel choose */
+   pages,	/* anonymous mapping with 4 KiB pages only */
+   thp,		/* anonymous mapping with transparent huge pages */
+   huge2m,	/* explicit 2 MiB huge pages */
+   huge1g,	/* explicit 1 GiB huge pages */
+};
+
+/* return the short name of a backing as used in the output,
+   i.e. one of "heap", "4k", "thp", "2m", or "1g" */
+const char* backing_name(Backing backing);
+
+/* parse a blank- or comma-separated list of backing names;
+   false is returned if an unknown name is encountered */
+bool parse_backings(const char* names, std::vector<Backing>& backings);
+
+/* return the size of the physical memory in bytes */
+std::size_t physical_memory();
+
+/* return the page size the given backing aims for */
+std::size_t backing_page_size(Backing backing);
+
+/* allocate a buffer of the given size with the given backing;
+   nullptr is returned if the backing is not available,
+   e.g. if no huge pages of the requested size are reserved;
+   if populate is true, all pages are faulted in in advance */
+void* allocate_buffer(std::size_t size, Backing backing,
+   bool populate = false);
+
+/* release a buffer that has been allocated by allocate_buffer */
+void free_buffer(void* buffer, std::size_t size, Backing backing);
+
+#endif
@@ -0,0 +1,104 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "memory-traffic.hpp"
+
+/* this variable must not be declared static */
+volatile std::size_t memory_traffic_global; // to defeat optimizations
+
+/* spend the given number of iterations of an empty loop */
+static inline void spin(unsigned int iterations) {
+   for (unsigned int i = 0; i < iterations; ++i) {
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+   }
+}
+
+void generate_traffic(char* buffer, std::size_t size,
+      unsigned int reads, unsigned int writes,
+      const std::atomic<unsigned int>& delay,
+      const std::atomic<bool>& stop, std::atomic<std::size_t>& bytes) {
+   constexpr std::size_t chunk = std::size_t{1}<<16;
+   constexpr std::size_t words = cache_line_size / sizeof(std::size_t);
+   unsigned int group = reads + writes;
+   if (group == 0) return;
+   std::size_t lines = size / cache_line_size;
+   std::size_t sum = 0;
+   std::size_t line = 0;
+   while (!stop.load(std::memory_order_relaxed)) {
+      unsigned int d = delay.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < chunk / cache_line_size; ++i) {
+	 std::size_t* p = (std::size_t*) (buffer + line * cache_line_size);
+	 if (line % group < reads) {
+	    sum += *p;
+	 } else {
+	    for (std::size_t w = 0; w < words; ++w) {
+	       p[w] = line;
+	    }
+	 }
+	 if (d) spin(d);
+	 if (++line == lines) line = 0;
+      }
+      bytes.fetch_add(chunk, std::memory_order_relaxed);
+   }
+   memory_traffic_global = sum;
+}
+
+void thrash_cache(char* buffer, std::size_t size,
+      const std::atomic<bool>& stop, std::atomic<std::size_t>& bytes) {
+   constexpr std::size_t chunk = std::size_t{1}<<16;
+   std::size_t lines = size / cache_line_size;
+   if (lines == 0) return;
+   /* an odd step of about 5/8 of the buffer that is coprime
+      to the number of lines lets us visit all of them */
+   auto gcd = [](std::size_t a, std::size_t b) {
+      while (b) {
+	 std::size_t r = a % b; a = b; b = r;
+      }
+      return a;
+   };
+   std::size_t step = (lines / 8 * 5) | 1;
+   while (gcd(step, lines) != 1) step += 2;
+   step %= lines;
+   std::size_t line = 0;
+   while (!stop.load(std::memory_order_relaxed)) {
+      for (std::size_t i = 0; i < chunk / cache_line_size; ++i) {
+	 std::size_t* p = (std::size_t*) (buffer + line * cache_line_size);
+	 *p += 1;
+	 line += step;
+	 if (line >= lines) line -= lines;
+      }
+      bytes.fetch_add(chunk, std::memory_order_relaxed);
+   }
+}
+
+std::size_t stream_read(const char* buffer, std::size_t size) {
+   const std::size_t* p = (const std::size_t*) buffer;
+   std::size_t len = size / sizeof(std::size_t);
+   std::size_t sum = 0;
+   for (std::size_t i = 0; i < len; ++i) {
+      sum += p[i];
+   }
+   return sum;
+}
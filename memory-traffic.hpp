@@ -0,0 +1,59 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef MEMORY_TRAFFIC_HPP
+#define MEMORY_TRAFFIC_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/* we assume this cache line size when generating traffic */
+constexpr std::size_t cache_line_size = 64;
+
+/* generate streaming traffic across the given buffer until stop
+   becomes true: of each group of reads + writes consecutive cache lines,
+   the first reads lines are read and the remaining writes lines
+   are written; after each line, delay iterations of an empty loop
+   are spent to throttle the injection rate;
+   the number of bytes read or written so far is published in bytes */
+void generate_traffic(char* buffer, std::size_t size,
+   unsigned int reads, unsigned int writes,
+   const std::atomic<unsigned int>& delay,
+   const std::atomic<bool>& stop, std::atomic<std::size_t>& bytes);
+
+/* read and write back one word of each cache line of the buffer
+   in a scattered order until stop becomes true where subsequent
+   lines are far apart such that the prefetchers do not help;
+   as the accesses are independent of each other, this keeps
+   as many dirty lines of the buffer in the caches as possible;
+   the number of bytes of the visited lines is published in bytes */
+void thrash_cache(char* buffer, std::size_t size,
+   const std::atomic<bool>& stop, std::atomic<std::size_t>& bytes);
+
+/* read all words of the given buffer once sequentially
+   and return their sum */
+std::size_t stream_read(const char* buffer, std::size_t size);
+
+#endif
@@ -0,0 +1,244 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that compares the read access times of random chains
+   in shared mappings of files with those in anonymous memory,
+   both with a warm page cache and cold after the pages of
+   the file have been evicted */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "file-mapping.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+#include "result-table.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE (std::size_t{1}<<20)
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{64}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of directories where the files are created,
+   e.g. on tmpfs or on a local file system */
+#ifndef DIRS
+#define DIRS "/dev/shm /var/tmp"
+#endif
+/* list of advices for the file mappings, see file-mapping.hpp */
+#ifndef ADVICES
+#define ADVICES "normal"
+#endif
+/* backing of the anonymous memory the file mappings are compared to */
+#ifndef BACKING
+#define BACKING "heap"
+#endif
+/* if POPULATE is defined, the files are mapped with MAP_POPULATE */
+#ifdef POPULATE
+constexpr bool populate = true;
+#else
+constexpr bool populate = false;
+#endif
+/* number of cold runs after evicting the pages of the file,
+   0 skips them */
+#ifndef COLD_RUNS
+#define COLD_RUNS 3
+#endif
+
+/* split a blank- or comma-separated list */
+std::vector<std::string> split(const char* names) {
+   std::vector<std::string> list;
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 list.emplace_back(names, len);
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return list;
+}
+
+int main() {
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKING, backings) || backings.size() != 1) {
+      std::cerr << "invalid backing: " << BACKING << std::endl;
+      std::exit(1);
+   }
+   std::vector<MapAdvice> advices;
+   if (!parse_advices(ADVICES, advices) || advices.empty()) {
+      std::cerr << "invalid list of advices: " << ADVICES << std::endl;
+      std::exit(1);
+   }
+   auto dirs = split(DIRS);
+   if (dirs.empty()) {
+      std::cerr << "no directories given" << std::endl;
+      std::exit(1);
+   }
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+
+   std::size_t max_size = MAX_SIZE;
+   MemoryArena arena(max_size, backings.front(), LOCK_MEMORY);
+   if (!arena.available()) {
+      std::cerr << "backing " << BACKING << " is not available" << std::endl;
+      std::exit(1);
+   }
+   /* one file mapping per directory and advice
+      that is reused for all sizes */
+   struct Mapping {
+      std::string name;
+      std::unique_ptr<FileMapping> file;
+   };
+   std::vector<Mapping> mappings;
+   for (auto& dir: dirs) {
+      for (auto advice: advices) {
+	 std::unique_ptr<FileMapping> file(new FileMapping(dir, max_size,
+	    advice, populate));
+	 if (!file->available()) {
+	    std::cerr << "unable to map a file in " << dir << std::endl;
+	 }
+	 mappings.push_back(Mapping{dir + " " + advice_name(advice),
+	    std::move(file)});
+      }
+   }
+
+   ResultTable table("mmap-chase", "memsize", 13, "ns", format);
+   if (table.text()) {
+      std::string name = backing_name(backings.front());
+      fmt::printf("              %s%s", std::string(36 - name.size(), ' '),
+	 name);
+      for (auto& mapping: mappings) {
+	 std::size_t width = COLD_RUNS > 0? 84: 48;
+	 if (mapping.name.size() < width) {
+	    fmt::printf("%s", std::string(width - mapping.name.size(), ' '));
+	 }
+	 fmt::printf("%s", mapping.name);
+      }
+      fmt::printf("\n       memsize      median         min      stddev");
+      for (std::size_t i = 0; i < mappings.size(); ++i) {
+	 fmt::printf("      median         min      stddev       delta");
+	 if (COLD_RUNS > 0) {
+	    fmt::printf("        cold    per page    resident");
+	 }
+      }
+      fmt::printf("\n");
+   }
+
+   for (std::size_t memsize = MIN_SIZE; memsize <= max_size;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      table.begin_row(memsize);
+
+      /* anonymous memory as reference */
+      std::string anon = backing_name(backings.front());
+      void** memory = arena.memory();
+      init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+      auto stats = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, measurement_parameters());
+      double reference = stats.median;
+      table.add(anon, "median", stats.median);
+      table.add(anon, "min", stats.min);
+      table.add(anon, "stddev", stats.stddev);
+
+      for (auto& mapping: mappings) {
+	 auto& file = mapping.file;
+	 if (!file->available()) {
+	    table.add_missing(mapping.name, "median");
+	    table.add_missing(mapping.name, "min");
+	    table.add_missing(mapping.name, "stddev");
+	    table.add_missing(mapping.name, "delta");
+	    if (COLD_RUNS > 0) {
+	       table.add_missing(mapping.name, "cold");
+	       table.add_missing(mapping.name, "per page", "us");
+	       table.add_missing(mapping.name, "resident", "%");
+	    }
+	    continue;
+	 }
+	 void** memory = file->memory();
+	 init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+	 auto stats = measure([=](std::size_t count) {
+	    return chase_pointers(memory, count);
+	 }, measurement_parameters());
+	 table.add(mapping.name, "median", stats.median);
+	 table.add(mapping.name, "min", stats.min);
+	 table.add(mapping.name, "stddev", stats.stddev);
+	 table.add(mapping.name, "delta", stats.median - reference);
+	 if (COLD_RUNS == 0) continue;
+
+	 /* cold runs: one pass through the chain after the pages
+	    of the file have been evicted where the excess time
+	    over the warm run is attributed to the page faults */
+	 std::size_t count = memsize / sizeof(void*);
+	 std::size_t page_size = file->page_size();
+	 std::size_t pages = (memsize + page_size - 1) / page_size;
+	 std::vector<double> times;
+	 double resident = 0;
+	 for (unsigned int run = 0; run < COLD_RUNS; ++run) {
+	    if (!file->drop_pages(memsize)) break;
+	    resident += file->resident(memsize);
+	    times.push_back(chase_pointers(file->memory(), count));
+	 }
+	 if (times.size() < COLD_RUNS) {
+	    std::cerr << "lost the mapping of a file in " << mapping.name <<
+	       std::endl;
+	    std::exit(1);
+	 }
+	 std::sort(times.begin(), times.end());
+	 double cold = times[times.size() / 2] * 1e9;
+	 table.add(mapping.name, "cold", cold / count);
+	 table.add(mapping.name, "per page",
+	    (cold - stats.median * count) / pages / 1000, "us");
+	 table.add(mapping.name, "resident", resident / COLD_RUNS * 100, "%");
+      }
+      table.end_row();
+   }
+}
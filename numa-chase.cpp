@@ -0,0 +1,164 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that measures read access times and read bandwidths
+   for all combinations of the NUMA node the memory is placed on
+   and the NUMA node of the CPU that accesses it */
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "cpu-affinity.hpp"
+#include "memory-backing.hpp"
+#include "memory-traffic.hpp"
+#include "numa.hpp"
+#include "random-chain.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+/* size of the randomized chain which should exceed the L3 cache */
+#ifndef MEMSIZE
+#define MEMSIZE (std::size_t{1}<<28)
+#endif
+/* number of pointers to be chased for each combination */
+#ifndef COUNT
+#define COUNT (std::size_t{1}<<25)
+#endif
+/* number of sequential passes for the bandwidth measurements */
+#ifndef PASSES
+#define PASSES 8
+#endif
+
+/* this variable must not be declared static */
+volatile std::size_t numa_chase_global; // to defeat optimizations
+
+/* run the given function in a thread pinned to the given CPU */
+template<typename Body>
+void run_on_cpu(unsigned int cpu, Body body) {
+   std::thread thread([=]() {
+      pin_thread(cpu);
+      body();
+   });
+   thread.join();
+}
+
+/* print a matrix with a row for each memory node
+   and a column for each CPU node */
+void print_matrix(const char* title,
+      const std::vector<unsigned int>& memory_nodes,
+      const std::vector<unsigned int>& cpu_nodes,
+      const std::vector<std::vector<double>>& values) {
+   fmt::printf("%s\n", title);
+   fmt::printf("   memory");
+   for (auto node: cpu_nodes) {
+      fmt::printf("    cpu %4u", node);
+   }
+   fmt::printf("\n");
+   for (std::size_t m = 0; m < memory_nodes.size(); ++m) {
+      fmt::printf("  node %2u", memory_nodes[m]);
+      for (std::size_t c = 0; c < cpu_nodes.size(); ++c) {
+	 if (values[m][c] > 0) {
+	    fmt::printf("  %10.5lf", values[m][c]);
+	 } else {
+	    fmt::printf("  %10s", "-");
+	 }
+      }
+      fmt::printf("\n");
+   }
+}
+
+int main() {
+   std::size_t memsize = MEMSIZE;
+   std::size_t count = COUNT;
+   auto memory_nodes = numa_nodes();
+   std::vector<unsigned int> cpu_nodes;
+   std::vector<unsigned int> node_cpu; // first CPU of each CPU node
+   for (auto node: memory_nodes) {
+      auto cpus = numa_node_cpus(node);
+      if (!cpus.empty()) {
+	 cpu_nodes.push_back(node); node_cpu.push_back(cpus.front());
+      }
+   }
+   if (cpu_nodes.empty()) {
+      std::cerr << "no CPUs available" << std::endl;
+      std::exit(1);
+   }
+
+   std::vector<std::vector<double>> latency(memory_nodes.size(),
+      std::vector<double>(cpu_nodes.size()));
+   std::vector<std::vector<double>> bandwidth(memory_nodes.size(),
+      std::vector<double>(cpu_nodes.size()));
+   for (std::size_t m = 0; m < memory_nodes.size(); ++m) {
+      unsigned int node = memory_nodes[m];
+      void** memory = (void**) allocate_buffer(memsize, Backing::pages);
+      if (!memory) {
+	 std::cerr << "out of memory" << std::endl;
+	 std::exit(1);
+      }
+      /* if binding is not supported, we depend on the first touch
+	 by a CPU of the memory node; this is not possible
+	 for memory-only nodes */
+      bool bound = numa_bind(memory, memsize, node);
+      unsigned int touching_cpu = node_cpu.front();
+      bool local = false;
+      for (std::size_t c = 0; c < cpu_nodes.size(); ++c) {
+	 if (cpu_nodes[c] == node) {
+	    touching_cpu = node_cpu[c]; local = true;
+	 }
+      }
+      if (!bound && !local && memory_nodes.size() > 1) {
+	 free_buffer(memory, memsize, Backing::pages);
+	 continue;
+      }
+      run_on_cpu(touching_cpu, [=]() {
+	 init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+      });
+      for (std::size_t c = 0; c < cpu_nodes.size(); ++c) {
+	 double& lat = latency[m][c];
+	 double& bw = bandwidth[m][c];
+	 run_on_cpu(node_cpu[c], [=, &lat, &bw]() {
+	    double t = chase_pointers(memory, count);
+	    lat = t * 1000000000 / count;
+	    std::size_t sum = stream_read((const char*) memory, memsize);
+	    WallTime<double> walltime;
+	    for (unsigned int pass = 0; pass < PASSES; ++pass) {
+	       sum += stream_read((const char*) memory, memsize);
+	    }
+	    double elapsed = walltime.elapsed();
+	    numa_chase_global = sum;
+	    bw = static_cast<double>(memsize) * PASSES / elapsed / (1<<30);
+	 });
+      }
+      free_buffer(memory, memsize, Backing::pages);
+   }
+
+   print_matrix("avg access times in ns", memory_nodes, cpu_nodes, latency);
+   fmt::printf("\n");
+   print_matrix("read bandwidth in GiB/s", memory_nodes, cpu_nodes,
+      bandwidth);
+}
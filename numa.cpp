@@ -0,0 +1,81 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "cpu-affinity.hpp"
+#include "numa.hpp"
+
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+
+static const char* sysfs_node_dir = "/sys/devices/system/node";
+
+/* read the first line of the given file, empty if not accessible */
+static std::string read_line(const std::string& path) {
+   std::ifstream in(path);
+   std::string line;
+   if (in) std::getline(in, line);
+   return line;
+}
+
+std::vector<unsigned int> numa_nodes() {
+   auto nodes = parse_cpu_list(read_line(std::string(sysfs_node_dir) +
+      "/online"));
+   if (nodes.empty()) nodes.push_back(0);
+   return nodes;
+}
+
+std::vector<unsigned int> numa_node_cpus(unsigned int node) {
+   auto available = available_cpus();
+   std::string list = read_line(std::string(sysfs_node_dir) +
+      "/node" + std::to_string(node) + "/cpulist");
+   if (list.empty()) {
+      /* no NUMA support, everything belongs to node 0 */
+      if (node == 0) return available;
+      return {};
+   }
+   std::vector<unsigned int> cpus;
+   for (auto cpu: parse_cpu_list(list)) {
+      if (std::find(available.begin(), available.end(), cpu) !=
+	    available.end()) {
+	 cpus.push_back(cpu);
+      }
+   }
+   return cpus;
+}
+
+bool numa_bind(void* memory, std::size_t size, unsigned int node) {
+   constexpr unsigned int bits = 8 * sizeof(unsigned long);
+   unsigned long mask[1024 / bits] = {};
+   if (node >= 1024) return false;
+   mask[node / bits] = 1ul << (node % bits);
+   return syscall(SYS_mbind, memory, size, MPOL_BIND, mask,
+      sizeof(mask) * 8 + 1, 0) == 0;
+}
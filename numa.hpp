@@ -0,0 +1,46 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <cstddef>
+#include <vector>
+
+/* return the online NUMA nodes; on systems without NUMA support
+   just node 0 is returned */
+std::vector<unsigned int> numa_nodes();
+
+/* return the available CPUs of the given node which may be empty
+   for memory-only nodes; on systems without NUMA support all
+   available CPUs are returned for node 0 */
+std::vector<unsigned int> numa_node_cpus(unsigned int node);
+
+/* bind the given page-aligned memory area to the given node,
+   this has to be done before the memory is touched first;
+   false is returned if this is not supported */
+bool numa_bind(void* memory, std::size_t size, unsigned int node);
+
+#endif
@@ -0,0 +1,114 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that samples the access times of a randomized pointer
+   chain in short bursts and reports percentiles of the distribution
+   for each buffer size instead of just the average */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "latency-histogram.hpp"
+#include "random-chain.hpp"
+#include "timestamp.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* number of pointers chased within one timed burst */
+#ifndef BURST_LENGTH
+#define BURST_LENGTH 4
+#endif
+/* number of timed bursts per buffer size */
+#ifndef BURSTS
+#define BURSTS (std::size_t{1}<<22)
+#endif
+/* number of sub-buckets per power of two of the histogram */
+#ifndef SUBBUCKETS
+#define SUBBUCKETS 16
+#endif
+
+/* the timestamp counter runs at a reference frequency
+   and not at the current frequency of the core */
+#if defined(__x86_64__) || defined(__i386__)
+static const char* ticks = "TSC ticks";
+#else
+static const char* ticks = "clock ticks";
+#endif
+
+int main() {
+   double frequency = timestamp_frequency();
+   double overhead = timestamp_overhead();
+   const double percentiles[] = {50, 90, 99, 99.9};
+
+   fmt::printf("#  %.5lf %s per ns, overhead of %.1lf ticks;"
+      " ticks are not core cycles\n", frequency, ticks, overhead);
+   fmt::printf("%26s%-36s%15s%-33s %13s\n", "",
+      std::string("percentiles in ") + ticks, "", "percentiles in ns",
+      "bursts below");
+   fmt::printf("       memsize");
+   for (int i = 0; i < 2; ++i) {
+      fmt::printf("         p50         p90         p99       p99.9");
+   }
+   fmt::printf(" %13s\n", "overhead in %");
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      void** memory = create_random_chain(memsize, SEED, CHAIN_THREADS);
+      LatencyHistogram histogram(SUBBUCKETS);
+      /* warm up with one round through the chain */
+      chase_pointers(memory, memsize / sizeof(void*));
+      std::size_t underflows = sample_chase_pointers(memory,
+	 BURSTS, BURST_LENGTH, overhead, histogram);
+      delete[] memory;
+      fmt::printf(" %13u", memsize);
+      for (auto p: percentiles) {
+	 fmt::printf("  %10.2lf", histogram.percentile(p));
+      }
+      for (auto p: percentiles) {
+	 fmt::printf("  %10.3lf", histogram.percentile(p) / frequency);
+      }
+      fmt::printf(" %13.3lf", 100.0 * underflows / BURSTS);
+      fmt::printf("\n"); std::cout.flush();
+   }
+}
@@ -0,0 +1,129 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "perf-counters.hpp"
+
+namespace {
+
+struct EventSpec {
+   const char* name;
+   std::uint32_t type;
+   std::uint64_t config;
+};
+
+constexpr std::uint64_t cache_event(std::uint64_t cache, std::uint64_t op,
+      std::uint64_t result) {
+   return cache | (op << 8) | (result << 16);
+}
+
+const EventSpec event_specs[] = {
+   {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+   {"instrs", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+   {"L1D-miss", PERF_TYPE_HW_CACHE,
+      cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+	 PERF_COUNT_HW_CACHE_RESULT_MISS)},
+   {"LLC-miss", PERF_TYPE_HW_CACHE,
+      cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+	 PERF_COUNT_HW_CACHE_RESULT_MISS)},
+   {"dTLB-miss", PERF_TYPE_HW_CACHE,
+      cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+	 PERF_COUNT_HW_CACHE_RESULT_MISS)},
+   {"L1D-pref", PERF_TYPE_HW_CACHE,
+      cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_PREFETCH,
+	 PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+};
+
+int perf_event_open(perf_event_attr* attr, int group_fd) {
+   return syscall(SYS_perf_event_open, attr, 0, -1, group_fd, 0);
+}
+
+} // namespace
+
+PerfCounters::PerfCounters() {
+   int leader = -1;
+   for (auto& spec: event_specs) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof attr);
+      attr.size = sizeof attr;
+      attr.type = spec.type;
+      attr.config = spec.config;
+      attr.disabled = leader < 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP |
+	 PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      int fd = perf_event_open(&attr, leader);
+      if (fd < 0) continue;
+      if (leader < 0) leader = fd;
+      events.push_back(Event{fd, spec.name});
+   }
+   totals.resize(events.size());
+}
+
+PerfCounters::~PerfCounters() {
+   /* close the members before the leader */
+   for (std::size_t i = events.size(); i > 0; --i) {
+      close(events[i-1].fd);
+   }
+}
+
+void PerfCounters::start() {
+   if (events.empty()) return;
+   ioctl(events[0].fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+   ioctl(events[0].fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfCounters::stop() {
+   if (events.empty()) return;
+   ioctl(events[0].fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+   /* layout of PERF_FORMAT_GROUP with both time fields:
+      nr, time_enabled, time_running, value[nr] */
+   std::vector<std::uint64_t> buf(3 + events.size());
+   ssize_t len = read(events[0].fd, buf.data(),
+      buf.size() * sizeof(std::uint64_t));
+   std::uint64_t running = len < (ssize_t) (3 * sizeof(std::uint64_t))?
+      0: buf[2];
+   if (running == 0) {
+      /* the group was never put onto the PMU, e.g. because
+	 of multiplexing with other groups that are not able
+	 to share the PMU with us, such that nothing was counted */
+      unscheduled = true; return;
+   }
+   std::uint64_t enabled = buf[1];
+   double scale = static_cast<double>(enabled) / running;
+   for (std::size_t i = 0; i < events.size() && i < buf[0]; ++i) {
+      totals[i] += buf[3 + i] * scale;
+   }
+}
+
+void PerfCounters::reset() {
+   for (auto& total: totals) total = 0;
+   unscheduled = false;
+}
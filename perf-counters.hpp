@@ -0,0 +1,76 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* group of hardware performance counters of the calling thread
+   that are opened using perf_event_open(2), restricted to user space;
+   events that are not supported are silently dropped, and if
+   no event is supported (e.g. due to missing permissions or
+   missing PMU support), the group remains empty */
+class PerfCounters {
+   public:
+      PerfCounters();
+      ~PerfCounters();
+      PerfCounters(const PerfCounters&) = delete;
+      PerfCounters& operator=(const PerfCounters&) = delete;
+
+      bool available() const { return !events.empty(); }
+      /* number of available events */
+      std::size_t size() const { return events.size(); }
+      /* short name of the i-th event */
+      const char* name(std::size_t i) const { return events[i].name; }
+      /* value of the i-th event accumulated since the last reset,
+	 scaled if the group was not scheduled all the time */
+      double value(std::size_t i) const { return totals[i]; }
+      /* false if the group was not scheduled at all during one
+	 of the counting intervals since the last reset, i.e. if
+	 the accumulated values are incomplete */
+      bool scheduled() const { return !unscheduled; }
+
+      /* start counting */
+      void start();
+      /* stop counting and accumulate the values */
+      void stop();
+      /* reset the accumulated values */
+      void reset();
+
+   private:
+      struct Event {
+	 int fd;
+	 const char* name;
+      };
+      std::vector<Event> events;
+      std::vector<double> totals;
+      bool unscheduled = false;
+};
+
+#endif
@@ -0,0 +1,44 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef POINTER_CHASING_HPP
+#define POINTER_CHASING_HPP
+
+/* public interface of the pointer-chasing library:
+   chain builders, chase kernels, measurement harness,
+   sweep drivers, and quick_probe */
+
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "chase-sweeps.hpp"
+#include "linear-chain.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "memory-backing.hpp"
+#include "probe.hpp"
+#include "random-chain.hpp"
+#include "strided-chain.hpp"
+
+#endif
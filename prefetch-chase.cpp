@@ -0,0 +1,113 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* variant of linear-chase where each element carries, besides
+   the pointer to the next element, a pointer to the element
+   that follows a given distance later which is prefetched
+   by software; this is swept for various distances and strides
+   and compared to the hardware prefetches alone */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "linear-chain.hpp"
+#include "measurement.hpp"
+#include "utility-config.hpp"
+
+/* the strides are multiples of two words as each
+   element consists of two pointers */
+#ifndef MIN_STRIDE
+#define MIN_STRIDE (2 * sizeof(void*))
+#endif
+#ifndef MAX_STRIDE
+#define MAX_STRIDE 512
+#endif
+/* prefetch distances in elements which are doubled
+   from MIN_DISTANCE to MAX_DISTANCE */
+#ifndef MIN_DISTANCE
+#define MIN_DISTANCE 1
+#endif
+#ifndef MAX_DISTANCE
+#define MAX_DISTANCE 64
+#endif
+/* temporal locality hint of __builtin_prefetch,
+   from 0 (none, e.g. prefetchnta) to 3 (all levels, prefetcht0) */
+#ifndef LOCALITY
+#define LOCALITY 3
+#endif
+static_assert(MIN_STRIDE % (2 * sizeof(void*)) == 0,
+   "MIN_STRIDE must be a multiple of two words");
+
+int main() {
+   std::vector<std::size_t> distances;
+   for (std::size_t distance = MIN_DISTANCE; distance <= MAX_DISTANCE;
+	 distance *= 2) {
+      distances.push_back(distance);
+   }
+
+   fmt::printf("                      access times in ns for "
+      "prefetch distances\n");
+   fmt::printf("   stride        none");
+   for (auto distance: distances) {
+      fmt::printf("  %10u", distance);
+   }
+   fmt::printf("        best    speed-up\n");
+   for (std::size_t stride = MIN_STRIDE; stride <= MAX_STRIDE;
+	 stride += 2 * sizeof(void*)) {
+      size_t memsize = std::min(std::size_t{1}<<26,
+	 stride * 1024 * sizeof(void*));
+      void** memory = new void*[memsize / sizeof(void*)];
+      init_lookahead_chain(memory, memsize, stride, distances.front());
+      fmt::printf(" %8u", stride);
+
+      /* the same chain without software prefetches */
+      double none = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, measurement_parameters()).median;
+      fmt::printf("  %10.5lf", none); std::cout.flush();
+
+      std::size_t best = 0; double best_ns = none;
+      for (auto distance: distances) {
+	 set_lookahead(memory, distance);
+	 double ns = measure([=](std::size_t count) {
+	    return chase_prefetched_pointers(memory, count, LOCALITY);
+	 }, measurement_parameters()).median;
+	 if (ns < best_ns) {
+	    best = distance; best_ns = ns;
+	 }
+	 fmt::printf("  %10.5lf", ns); std::cout.flush();
+      }
+      delete[] memory;
+      if (best) {
+	 fmt::printf("  %10u", best);
+      } else {
+	 fmt::printf("  %10s", "none");
+      }
+      fmt::printf("  %10.5lf\n", none / best_ns); std::cout.flush();
+   }
+}
@@ -0,0 +1,122 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <memory>
+#include <sched.h>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "cpu-topology.hpp"
+#include "memory-arena.hpp"
+#include "probe.hpp"
+#include "strided-chain.hpp"
+#include "walltime.hpp"
+
+/* evict all elements of the given chain from the caches
+   where this is supported */
+static void flush_chain(void** memory) {
+   void** p = memory;
+   do {
+      void** next = (void**) *p;
+#if defined(__x86_64__)
+      _mm_clflush(p);
+#elif defined(__aarch64__)
+      asm volatile("dc civac, %0" : : "r"(p) : "memory");
+#endif
+      p = next;
+   } while (p != memory);
+#if defined(__x86_64__)
+   _mm_mfence();
+#elif defined(__aarch64__)
+   asm volatile("dsb ish" : : : "memory");
+#endif
+}
+
+ProbeResult quick_probe(const ProbeParameters& params) {
+   WallTime<double> walltime;
+   ProbeResult result;
+   int cpu = sched_getcpu();
+   auto caches = cpu_caches(cpu >= 0? cpu: 0);
+   result.line_size = caches.empty()? 64: caches.front().line_size;
+
+   std::size_t arena_size = params.dram_size;
+   for (auto& cache: caches) {
+      arena_size = std::max(arena_size, cache.size / 2);
+   }
+   std::unique_ptr<MemoryArena> arena(
+      new MemoryArena(arena_size, params.backing));
+   if (!arena->available()) {
+      arena.reset(new MemoryArena(arena_size));
+   }
+   void** memory = arena->memory();
+
+   /* random chain over all lines of a buffer of the given size */
+   auto measure_size = [&](std::size_t size) {
+      std::size_t lines = std::max(std::size_t{2}, size / result.line_size);
+      init_strided_chain(memory, lines, result.line_size, params.seed);
+      return measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, params.measurement).median;
+   };
+
+   if (!caches.empty()) {
+      for (auto& cache: caches) {
+	 result.levels.push_back(LatencyEstimate{cache.level, cache.size,
+	    measure_size(cache.size / 2)});
+      }
+   } else {
+      std::vector<Sample> samples;
+      for (std::size_t size = std::size_t{1}<<12; size <= params.dram_size;
+	    size *= 2) {
+	 samples.push_back(Sample{size, measure_size(size)});
+      }
+      auto levels = detect_levels(samples, 0.15, 1.5, 1.3);
+      for (std::size_t i = 0; i + 1 < levels.size(); ++i) {
+	 result.levels.push_back(LatencyEstimate{(unsigned int) i + 1,
+	    levels[i].last, levels[i].ns});
+      }
+   }
+
+   /* main memory: as a warm-up would bring a chain that is small
+      enough for a short measurement into the caches, a single run
+      through a sparse chain is timed after flushing it */
+   std::size_t page_size = params.dram_size / params.dram_pages;
+   init_page_chain(memory, params.dram_pages, page_size,
+      result.line_size, params.seed);
+   std::vector<double> times;
+   for (unsigned int run = 0; run < params.dram_runs; ++run) {
+      flush_chain(memory);
+      double t = chase_pointers(memory, params.dram_pages);
+      times.push_back(t * 1e9 / params.dram_pages);
+   }
+   std::sort(times.begin(), times.end());
+   result.levels.push_back(LatencyEstimate{0, 0, times[times.size() / 2]});
+
+   result.seconds = walltime.elapsed();
+   return result;
+}
@@ -0,0 +1,82 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef PROBE_HPP
+#define PROBE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "measurement.hpp"
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+
+/* parameters of quick_probe which keep it well below 200 ms */
+struct ProbeParameters {
+   /* size of the buffer for main memory, one line per page of
+      it is visited after all of them have been flushed */
+   std::size_t dram_size = std::size_t{64}<<20;
+   std::size_t dram_pages = std::size_t{1}<<14;
+   unsigned int dram_runs = 5;
+   /* transparent huge pages avoid most TLB misses;
+      if not available, the heap is taken instead */
+   Backing backing = Backing::thp;
+   std::uint64_t seed = chase_defaults::seed;
+   /* measurement of the caches */
+   MeasurementParameters measurement = quick_measurement();
+
+   static MeasurementParameters quick_measurement() {
+      MeasurementParameters params;
+      params.sample_time = 0.001;
+      params.warmups = 1;
+      params.min_samples = 3;
+      params.time_budget = 0.01;
+      return params;
+   }
+};
+
+/* estimated capacity and access time of a cache level or main memory */
+struct LatencyEstimate {
+   unsigned int level;		/* 1, 2, ... for caches, 0 for main memory */
+   std::size_t capacity;	/* in bytes, 0 for main memory */
+   double ns;			/* average access time */
+};
+
+struct ProbeResult {
+   /* caches in ascending order of their levels followed by
+      main memory */
+   std::vector<LatencyEstimate> levels;
+   std::size_t line_size;
+   double seconds;		/* time spent by the probe */
+};
+
+/* estimate the access times of all data caches and main memory
+   of the calling thread's CPU within a small fraction of a second;
+   the capacities are taken from /sys/devices/system/cpu and each
+   cache is measured with a random chain over half of its capacity;
+   if the caches are not known, they are detected by a coarse sweep */
+ProbeResult quick_probe(const ProbeParameters& params = ProbeParameters());
+
+#endif
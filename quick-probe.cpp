@@ -0,0 +1,48 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that prints the estimates of quick_probe and
+   serves as an example of the use of the library */
+
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "pointer-chasing.hpp"
+#include "utility-config.hpp"
+
+int main() {
+   ProbeParameters params;
+   params.seed = SEED;
+   auto result = quick_probe(params);
+   fmt::printf("    level        capacity  time in ns\n");
+   for (auto& level: result.levels) {
+      if (level.level > 0) {
+	 fmt::printf("       L%u  %14u  %10.5lf\n",
+	    level.level, level.capacity, level.ns);
+      } else {
+	 fmt::printf("     DRAM  %14s  %10.5lf\n", "-", level.ns);
+      }
+   }
+   fmt::printf("\n# line size %u, probe took %.1lf ms\n",
+      result.line_size, result.seconds * 1000);
+}
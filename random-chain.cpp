@@ -0,0 +1,174 @@
+/* 
+   Copyright (c) 2016, 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+#include "random-chain.hpp"
+#include "uniform-int-distribution.hpp"
+
+/* generate a cyclic permutation in place using Sattolo's algorithm,
+   see Sandra Sattolo: An algorithm to generate a random cyclic
+   permutation, Information Processing Letters 22(6), 1986;
+   memory[i] refers in the end to the successor of i */
+static void sattolo_chain(void** memory, std::size_t len,
+      std::uint64_t seed) {
+   UniformIntDistribution uniform(seed);
+   for (std::size_t i = 0; i < len; ++i) {
+      memory[i] = (void*) &memory[i];
+   }
+   for (std::size_t i = len - 1; i > 0; --i) {
+      std::size_t j = uniform.draw(i);
+      std::swap(memory[i], memory[j]);
+   }
+}
+
+/* pseudo-random permutation of [0..len) composed of rounds of
+   invertible operations modulo 2^bits (xor with a key, multiplication
+   by an odd number, and a xorshift by at least half of the bits)
+   where 2^bits is the smallest power of two not less than len
+   and values beyond len are cycle-walked */
+class RandomPermutation {
+   public:
+      RandomPermutation(std::size_t len, std::uint64_t seed) :
+	    len(len), bits(0) {
+	 while (bits < 64 && (std::uint64_t{1} << bits) < len) ++bits;
+	 mask = bits < 64? (std::uint64_t{1} << bits) - 1: ~std::uint64_t{0};
+	 shift = (bits + 1) / 2;
+	 for (unsigned int i = 0; i < rounds; ++i) {
+	    keys[i] = splitmix64(seed) & mask;
+	    factors[i] = splitmix64(seed) | 1;
+	    /* inverse modulo 2^64 by Newton's iteration where
+	       each step doubles the number of correct bits */
+	    std::uint64_t inverse = factors[i];
+	    for (int j = 0; j < 5; ++j) {
+	       inverse *= 2 - factors[i] * inverse;
+	    }
+	    inverses[i] = inverse;
+	 }
+      }
+      std::size_t operator()(std::size_t index) const {
+	 std::uint64_t value = index;
+	 do {
+	    value = permute(value);
+	 } while (value >= len);
+	 return value;
+      }
+      std::size_t inverse(std::size_t index) const {
+	 std::uint64_t value = index;
+	 do {
+	    value = unpermute(value);
+	 } while (value >= len);
+	 return value;
+      }
+   private:
+      static constexpr unsigned int rounds = 4;
+      std::size_t len;
+      unsigned int bits;
+      unsigned int shift;
+      std::uint64_t mask;
+      std::uint64_t keys[rounds];
+      std::uint64_t factors[rounds];
+      std::uint64_t inverses[rounds];
+
+      std::uint64_t permute(std::uint64_t value) const {
+	 for (unsigned int i = 0; i < rounds; ++i) {
+	    value = ((value ^ keys[i]) * factors[i]) & mask;
+	    value ^= value >> shift;
+	 }
+	 return value;
+      }
+      std::uint64_t unpermute(std::uint64_t value) const {
+	 for (unsigned int i = rounds; i > 0; --i) {
+	    /* the xorshift is its own inverse as 2 * shift >= bits */
+	    value ^= value >> shift;
+	    value = ((value * inverses[i-1]) & mask) ^ keys[i-1];
+	 }
+	 return value;
+      }
+};
+
+/* link the elements in the order of the given permutation
+   where each of the threads fills a contiguous range of the
+   memory section with the successors of its elements;
+   as the successor of i is perm(perm.inverse(i) + 1),
+   the memory is written sequentially and no additional
+   memory is needed */
+static void parallel_chain(void** memory, std::size_t len,
+      std::uint64_t seed, unsigned int threads) {
+   RandomPermutation perm(len, seed);
+   auto link = [=, &perm](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+	 std::size_t pos = perm.inverse(i) + 1;
+	 memory[i] = (void*) &memory[perm(pos < len? pos: 0)];
+      }
+   };
+   std::vector<std::thread> workers;
+   for (unsigned int t = 0; t < threads; ++t) {
+      std::size_t begin = len / threads * t;
+      std::size_t end = t + 1 < threads? len / threads * (t + 1): len;
+      workers.push_back(std::thread(link, begin, end));
+   }
+   for (auto& worker: workers) {
+      worker.join();
+   }
+}
+
+/* fill the given memory section of the given size with a cyclic
+   pointer chain that covers all its words in a randomized order */
+void init_random_chain(void** memory, std::size_t size,
+      std::uint64_t seed, unsigned int threads) {
+   std::size_t len = size / sizeof(void*);
+   if (len == 0) return;
+   if (seed == 0) {
+      std::random_device device;
+      seed = (std::uint64_t{device()} << 32) | device();
+   }
+   if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+   }
+   if (threads > 1 && len >= threads) {
+      parallel_chain(memory, len, seed, threads);
+   } else {
+      sattolo_chain(memory, len, seed);
+   }
+}
+
+/* create a cyclic pointer chain that covers all words
+   in a memory section of the given size in a randomized order */
+void** create_random_chain(std::size_t size,
+      std::uint64_t seed, unsigned int threads) {
+   void** memory = new void*[size / sizeof(void*)];
+   init_random_chain(memory, size, seed, threads);
+   return memory;
+}
+
+void** create_random_chain(std::size_t size, Backing backing,
+      std::uint64_t seed, unsigned int threads) {
+   void** memory = (void**) allocate_buffer(size, backing);
+   if (memory) init_random_chain(memory, size, seed, threads);
+   return memory;
+}
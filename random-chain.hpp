@@ -0,0 +1,66 @@
+/* 
+   Copyright (c) 2016, 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef RANDOM_CHAIN_HPP
+#define RANDOM_CHAIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "memory-backing.hpp"
+
+namespace chase_defaults {
+   /* seed for the random chains, 0 selects a random seed */
+   constexpr std::uint64_t seed = 0;
+   /* number of threads that construct a random chain,
+      0 selects one thread per hardware thread */
+   constexpr unsigned int chain_threads = 1;
+} // namespace chase_defaults
+
+/* fill the given memory section of the given size with a cyclic
+   pointer chain that covers all its words in a randomized order;
+   the chain is reproducible for a given non-zero seed and
+   the choice between a single and multiple threads:
+   a single thread generates a uniformly distributed cyclic
+   permutation using Sattolo's algorithm, multiple threads
+   follow a pseudo-random permutation that is derived from
+   the seed and computed independently for each element */
+void init_random_chain(void** memory, std::size_t size,
+   std::uint64_t seed = chase_defaults::seed,
+   unsigned int threads = chase_defaults::chain_threads);
+
+/* create a cyclic pointer chain that covers all words
+   in a memory section of the given size in a randomized order */
+void** create_random_chain(std::size_t size,
+   std::uint64_t seed = chase_defaults::seed,
+   unsigned int threads = chase_defaults::chain_threads);
+
+/* likewise but for a memory section with the given backing
+   which is to be released using free_buffer;
+   nullptr is returned if the backing is not available */
+void** create_random_chain(std::size_t size, Backing backing,
+   std::uint64_t seed = chase_defaults::seed,
+   unsigned int threads = chase_defaults::chain_threads);
+
+#endif
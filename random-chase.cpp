@@ -29,37 +29,18 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 #include <printf.hpp> /* see https://github.com/afborchert/fmt */
 #include "chase-pointers.hpp"
-#include "uniform-int-distribution.hpp"
-
-/* create a cyclic pointer chain that covers all words
-   in a memory section of the given size in a randomized order */
-void** create_random_chain(std::size_t size) {
-   std::size_t len = size / sizeof(void*);
-   void** memory = new void*[len];
-
-   UniformIntDistribution uniform;
-
-   // shuffle indices
-   size_t* indices = new std::size_t[len];
-   for (std::size_t i = 0; i < len; ++i) {
-      indices[i] = i;
-   }
-   for (std::size_t i = 0; i < len-1; ++i) {
-      std::size_t j = i + uniform.draw(len - i);
-      if (i != j) {
-	 std::swap(indices[i], indices[j]);
-      }
-   }
-   // fill memory with pointer references
-   for (std::size_t i = 1; i < len; ++i) {
-      memory[indices[i-1]] = (void*) &memory[indices[i]];
-   }
-   memory[indices[len-1]] = (void*) &memory[indices[0]];
-   delete[] indices;
-   return memory;
-}
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "memory-backing.hpp"
+#include "perf-counters.hpp"
+#include "random-chain.hpp"
+#include "result-table.hpp"
+#include "utility-config.hpp"
 
 unsigned int log2(std::size_t val) {
    unsigned int count = 0;
@@ -72,23 +53,150 @@ unsigned int log2(std::size_t val) {
 #ifndef MIN_SIZE
 #define MIN_SIZE 1024
 #endif
+/* maximal buffer size in bytes; 0 selects the largest power of two
+   such that the buffers of all backings fit into half of the
+   physical memory */
 #ifndef MAX_SIZE
-#define MAX_SIZE 1024 * 1024 * 128
+#define MAX_SIZE (std::size_t{128}<<20)
 #endif
 #ifndef GRANULARITY
 #define GRANULARITY (1u)
 #endif
+/* list of backings of the chain buffer,
+   see memory-backing.hpp for the supported names */
+#ifndef BACKINGS
+#define BACKINGS "heap"
+#endif
+/* if SUBTRACT_OVERHEAD is defined, the overhead of the unrolled
+   loop, as measured by an empty loop, is subtracted from the median
+   and the minimum */
+/* if PERF_COUNTERS is defined, hardware performance counters
+   per access are given for each measurement where available */
 
 int main() {
-   fmt::printf("   memsize  time in ns\n");
-   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKINGS, backings) || backings.empty()) {
+      std::cerr << "invalid list of backings: " << BACKINGS << std::endl;
+      std::exit(1);
+   }
+   /* with multiple backings, the difference between the first
+      and the last backing is given in an additional column,
+      e.g. for "4k 2m" this is the share of the page walks */
+   bool delta = backings.size() > 1;
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+
+   std::size_t max_size = MAX_SIZE;
+   if (max_size == 0) {
+      std::size_t limit = physical_memory() / 2 / backings.size();
+      max_size = MIN_SIZE;
+      while (max_size * 2 <= limit) max_size *= 2;
+   }
+
+   /* one arena per backing that is reused for all sizes */
+   std::vector<std::unique_ptr<MemoryArena>> arenas;
+   for (auto backing: backings) {
+      arenas.emplace_back(new MemoryArena(max_size, backing, LOCK_MEMORY));
+      if (LOCK_MEMORY && arenas.back()->available() &&
+	    !arenas.back()->locked()) {
+	 std::cerr << "unable to lock memory" << std::endl;
+      }
+   }
+
+   std::unique_ptr<PerfCounters> counters;
+#ifdef PERF_COUNTERS
+   counters.reset(new PerfCounters());
+   if (!counters->available()) {
+      std::cerr << "performance counters are not available" << std::endl;
+      counters.reset();
+   }
+#endif
+   std::size_t nof_counters = counters? counters->size(): 0;
+   ChaseKernel chase = chase_kernel(UNROLL);
+   double overhead = 0;
+#ifdef SUBTRACT_OVERHEAD
+   overhead = measure([](std::size_t count) {
+      return chase_loop_overhead(count, UNROLL);
+   }, measurement_parameters()).median;
+#endif
+
+   ResultTable table("random-chase", "memsize", 13, "ns", format);
+   if (table.text() && delta) {
+      fmt::printf("              ");
+      for (auto backing: backings) {
+	 std::string name = backing_name(backing);
+	 std::size_t width = 36 + 12 * nof_counters;
+	 fmt::printf("%s%s", std::string(width - name.size(), ' '), name);
+      }
+      fmt::printf("\n");
+   }
+   if (table.text()) {
+      fmt::printf("       memsize");
+      for (std::size_t i = 0; i < backings.size(); ++i) {
+	 fmt::printf("      median         min      stddev");
+	 for (std::size_t j = 0; j < nof_counters; ++j) {
+	    fmt::printf("  %10s", counters->name(j));
+	 }
+      }
+      if (delta) {
+	 fmt::printf("  %5s-%-4s", backing_name(backings.front()),
+	    backing_name(backings.back()));
+      }
+      fmt::printf("\n");
+   }
+   for (std::size_t memsize = MIN_SIZE; memsize <= max_size;
 	 memsize += (std::size_t{1} <<
 	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
-      void** memory = create_random_chain(memsize);
-      std::size_t count = std::max(memsize * 16, std::size_t{1}<<30);
-      double t = chase_pointers(memory, count);
-      delete[] memory;
-      double ns = t * 1000000000 / count;
-      fmt::printf(" %9u  %10.5lf\n", memsize, ns); std::cout.flush();
+      table.begin_row(memsize);
+      double first = 0, last = 0;
+      bool available = true;
+      for (std::size_t i = 0; i < backings.size(); ++i) {
+	 std::string group = backing_name(backings[i]);
+	 if (!arenas[i]->available()) {
+	    table.add_missing(group, "median");
+	    table.add_missing(group, "min");
+	    table.add_missing(group, "stddev");
+	    for (std::size_t j = 0; j < nof_counters; ++j) {
+	       table.add_missing(group, counters->name(j), "per access");
+	    }
+	    available = false; continue;
+	 }
+	 void** memory = arenas[i]->memory();
+	 init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+	 if (counters) counters->reset();
+	 std::size_t accesses = 0;
+	 auto stats = measure([=, &counters, &accesses](std::size_t count) {
+	    accesses += count;
+	    return chase(memory, count, counters.get());
+	 }, measurement_parameters());
+	 stats.median -= overhead;
+	 stats.min -= overhead;
+	 if (i == 0) first = stats.median;
+	 last = stats.median;
+	 table.add(group, "median", stats.median);
+	 table.add(group, "min", stats.min);
+	 table.add(group, "stddev", stats.stddev);
+	 for (std::size_t j = 0; j < nof_counters; ++j) {
+	    if (counters->scheduled()) {
+	       table.add(group, counters->name(j),
+		  counters->value(j) / accesses, "per access");
+	    } else {
+	       table.add_missing(group, counters->name(j), "per access");
+	    }
+	 }
+      }
+      if (delta) {
+	 std::string group = std::string(backing_name(backings.front())) +
+	    "-" + backing_name(backings.back());
+	 if (available) {
+	    table.add(group, "delta", first - last);
+	 } else {
+	    table.add_missing(group, "delta");
+	 }
+      }
+      table.end_row();
    }
 }
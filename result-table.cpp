@@ -0,0 +1,169 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "host-info.hpp"
+#include "result-table.hpp"
+
+bool parse_output_format(const std::string& name, OutputFormat& format) {
+   if (name == "text") {
+      format = OutputFormat::text;
+   } else if (name == "csv") {
+      format = OutputFormat::csv;
+   } else if (name == "json") {
+      format = OutputFormat::json;
+   } else {
+      return false;
+   }
+   return true;
+}
+
+namespace {
+
+std::string csv_field(const std::string& s) {
+   if (s.find_first_of(",\"\n") == std::string::npos) return s;
+   std::string quoted = "\"";
+   for (char ch: s) {
+      if (ch == '"') quoted += '"';
+      quoted += ch;
+   }
+   return quoted + "\"";
+}
+
+std::string json_string(const std::string& s) {
+   std::string quoted = "\"";
+   for (char ch: s) {
+      switch (ch) {
+	 case '"': quoted += "\\\""; break;
+	 case '\\': quoted += "\\\\"; break;
+	 case '\n': quoted += "\\n"; break;
+	 case '\t': quoted += "\\t"; break;
+	 default:
+	    if (static_cast<unsigned char>(ch) < 0x20) {
+	       quoted += ' ';
+	    } else {
+	       quoted += ch;
+	    }
+      }
+   }
+   return quoted + "\"";
+}
+
+} // namespace
+
+ResultTable::ResultTable(const char* utility, const char* key,
+      unsigned int key_width, const char* unit, OutputFormat format) :
+      key_name(key), key_width(key_width), unit(unit), format(format) {
+   auto info = host_info();
+   switch (format) {
+      case OutputFormat::text:
+	 break;
+      case OutputFormat::csv:
+	 fmt::printf("# utility: %s\n", utility);
+	 for (auto& entry: info) {
+	    fmt::printf("# %s: %s\n", entry.first, entry.second);
+	 }
+	 fmt::printf("%s,group,metric,unit,value\n", csv_field(key_name));
+	 break;
+      case OutputFormat::json:
+	 fmt::printf("{\n  \"utility\": %s,\n  \"host\": {", json_string(utility));
+	 for (std::size_t i = 0; i < info.size(); ++i) {
+	    fmt::printf("%s\n    %s: %s", i? ",": "",
+	       json_string(info[i].first), json_string(info[i].second));
+	 }
+	 fmt::printf("\n  },\n  \"key\": %s,\n  \"results\": [",
+	    json_string(key_name));
+	 break;
+   }
+   std::cout.flush();
+}
+
+ResultTable::~ResultTable() {
+   if (format == OutputFormat::json) {
+      fmt::printf("\n  ]\n}\n"); std::cout.flush();
+   }
+}
+
+void ResultTable::begin_row(std::size_t key) {
+   this->key = key;
+   if (format == OutputFormat::text) {
+      std::string number = std::to_string(key);
+      if (number.size() < key_width) {
+	 number = std::string(key_width - number.size(), ' ') + number;
+      }
+      fmt::printf(" %s", number);
+   }
+}
+
+void ResultTable::add(const std::string& group, const char* metric,
+      double value, const char* unit) {
+   if (format == OutputFormat::text) {
+      fmt::printf("  %10.5lf", value); std::cout.flush();
+   } else {
+      std::string text;
+      if (std::isfinite(value)) {
+	 char buf[64];
+	 std::snprintf(buf, sizeof buf, "%.5lf", value);
+	 text = buf;
+      }
+      record(group, metric, unit, text);
+   }
+}
+
+void ResultTable::add_missing(const std::string& group, const char* metric,
+      const char* unit) {
+   if (format == OutputFormat::text) {
+      fmt::printf("  %10s", "-"); std::cout.flush();
+   } else {
+      record(group, metric, unit, "");
+   }
+}
+
+void ResultTable::end_row() {
+   if (format == OutputFormat::text) {
+      fmt::printf("\n"); std::cout.flush();
+   }
+}
+
+void ResultTable::record(const std::string& group, const char* metric,
+      const char* unit, const std::string& value) {
+   if (!unit) unit = this->unit;
+   if (format == OutputFormat::csv) {
+      fmt::printf("%u,%s,%s,%s,%s\n", key, csv_field(group),
+	 csv_field(metric), csv_field(unit), value);
+   } else {
+      fmt::printf("%s\n    {%s: %u, \"group\": %s, \"metric\": %s, "
+	 "\"unit\": %s, \"value\": %s}",
+	 records? ",": "", json_string(key_name), key, json_string(group),
+	 json_string(metric), json_string(unit),
+	 value.empty()? "null": value);
+   }
+   ++records;
+   std::cout.flush();
+}
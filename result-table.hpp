@@ -0,0 +1,87 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef RESULT_TABLE_HPP
+#define RESULT_TABLE_HPP
+
+#include <cstddef>
+#include <string>
+
+/* format of the results: "text" gives the traditional fixed-width
+   columns for gnuplot, "csv" and "json" give one record per value
+   together with the metadata of the host, see host-info.hpp */
+#ifndef OUTPUT
+#define OUTPUT "text"
+#endif
+
+enum class OutputFormat {text, csv, json};
+
+/* parse the name of a format, return false if it is not known */
+bool parse_output_format(const std::string& name, OutputFormat& format);
+
+/* results of a sweep where each row is identified by its key
+   (e.g. memsize or stride) and each value within a row by the
+   group of its column (e.g. a backing or a fuse factor, possibly
+   empty) and its metric (e.g. median, min, stddev, or the name
+   of a performance counter);
+   in text format, the key and the values are printed as they come
+   in the fixed-width layout of the utilities while the header lines
+   remain the business of the utility;
+   otherwise, each value is printed as record of its own in long form
+   where missing values are given as empty (CSV) or null (JSON) values,
+   and the metadata precedes the records */
+class ResultTable {
+   public:
+      /* the key is printed in text format with a leading blank
+	 and the given width; unit is the default unit of the values,
+	 e.g. "ns" or "GiB/s" */
+      ResultTable(const char* utility, const char* key,
+	 unsigned int key_width, const char* unit, OutputFormat format);
+      ~ResultTable();
+      ResultTable(const ResultTable&) = delete;
+      ResultTable& operator=(const ResultTable&) = delete;
+
+      bool text() const { return format == OutputFormat::text; }
+
+      void begin_row(std::size_t key);
+      void add(const std::string& group, const char* metric, double value,
+	 const char* unit = nullptr);
+      void add_missing(const std::string& group, const char* metric,
+	 const char* unit = nullptr);
+      void end_row();
+
+   private:
+      void record(const std::string& group, const char* metric,
+	 const char* unit, const std::string& value);
+
+      const char* key_name;
+      unsigned int key_width;
+      const char* unit;
+      OutputFormat format;
+      std::size_t key = 0;
+      std::size_t records = 0;
+};
+
+#endif
@@ -0,0 +1,133 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef STATIC_BTREE_HPP
+#define STATIC_BTREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "aligned-allocator.hpp"
+
+/* B+-tree with nodes of NodeBytes bytes that maps 64-bit keys to
+   64-bit values; it is bulk-loaded from pairs sorted by their keys
+   and does not support updates; the nodes are taken from the given
+   allocator in the order of the levels beginning with the leaves
+   and are aligned to cache lines of LineSize bytes, i.e. the allocator
+   has to support extended alignments which std::allocator does not
+   before C++17 */
+template<std::size_t NodeBytes, typename Alloc = AlignedAllocator<char>,
+   std::size_t LineSize = 64>
+class StaticBTree {
+   public:
+      using Pairs = std::vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+      StaticBTree(const Pairs& pairs, const Alloc& alloc = Alloc()) :
+	    alloc(alloc), root(nullptr), height(0) {
+	 std::vector<Node*> level;
+	 for (std::size_t i = 0; i < pairs.size(); i += fanout) {
+	    Node* node = new_node();
+	    node->count = std::min(fanout, pairs.size() - i);
+	    for (std::size_t j = 0; j < node->count; ++j) {
+	       node->keys[j] = pairs[i + j].first;
+	       node->values[j] = pairs[i + j].second;
+	    }
+	    level.push_back(node);
+	 }
+	 while (level.size() > 1) {
+	    std::vector<Node*> parents;
+	    for (std::size_t i = 0; i < level.size(); i += fanout) {
+	       Node* node = new_node();
+	       node->count = std::min(fanout, level.size() - i);
+	       for (std::size_t j = 0; j < node->count; ++j) {
+		  node->keys[j] = level[i + j]->keys[0];
+		  node->children[j] = level[i + j];
+	       }
+	       parents.push_back(node);
+	    }
+	    level = std::move(parents);
+	    ++height;
+	 }
+	 if (!level.empty()) root = level[0];
+      }
+      ~StaticBTree() {
+	 for (auto node: nodes) {
+	    NodeTraits::deallocate(alloc, node, 1);
+	 }
+      }
+      StaticBTree(const StaticBTree&) = delete;
+      StaticBTree& operator=(const StaticBTree&) = delete;
+
+      /* return the value of the given key which must be present */
+      std::uint64_t find(std::uint64_t key) const {
+	 const Node* node = root;
+	 for (unsigned int level = height; level > 0; --level) {
+	    std::size_t i = 1;
+	    while (i < node->count && node->keys[i] <= key) ++i;
+	    node = node->children[i - 1];
+	 }
+	 std::size_t i = 0;
+	 while (node->keys[i] != key) ++i;
+	 return node->values[i];
+      }
+
+      /* number of nodes */
+      std::size_t size() const { return nodes.size(); }
+
+   private:
+      static constexpr std::size_t fanout =
+	 (NodeBytes - sizeof(std::uint64_t)) / (2 * sizeof(std::uint64_t));
+      static_assert(fanout >= 2, "nodes are too small");
+      static_assert(NodeBytes % LineSize == 0,
+	 "nodes must consist of whole cache lines");
+      struct alignas(LineSize) Node {
+	 std::uint64_t count;
+	 std::uint64_t keys[fanout];
+	 union {
+	    Node* children[fanout];
+	    std::uint64_t values[fanout];
+	 };
+	 char padding[NodeBytes - sizeof(std::uint64_t) * (1 + 2 * fanout)];
+      };
+      using NodeAlloc = typename std::allocator_traits<Alloc>::
+	 template rebind_alloc<Node>;
+      using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+      NodeAlloc alloc;
+      std::vector<Node*> nodes;
+      Node* root;
+      unsigned int height;
+
+      Node* new_node() {
+	 Node* node = NodeTraits::allocate(alloc, 1);
+	 nodes.push_back(node);
+	 return node;
+      }
+};
+
+#endif
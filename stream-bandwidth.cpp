@@ -0,0 +1,241 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* companion utility of random-chase that measures the bandwidths
+   of streaming kernels in the style of STREAM (read, write, copy,
+   and triad) for the same range of buffer sizes using scalar and
+   vectorized variants of the kernels and optionally multiple threads
+   that operate on their own buffers */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "cpu-affinity.hpp"
+#include "measurement.hpp"
+#include "memory-backing.hpp"
+#include "result-table.hpp"
+#include "stream-kernels.hpp"
+#include "thread-team.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+/* size of each of the arrays of each thread */
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of instruction sets, see stream-kernels.hpp
+   for the supported names; "best" selects the best supported one */
+#ifndef ISAS
+#define ISAS "best"
+#endif
+/* list of kernels out of "read", "write", "copy", and "triad" */
+#ifndef KERNELS
+#define KERNELS "read write copy triad"
+#endif
+/* number of threads, 0 selects one per available CPU */
+#ifndef THREADS
+#define THREADS 1
+#endif
+/* backing of the arrays, see memory-backing.hpp */
+#ifndef BACKING
+#define BACKING "heap"
+#endif
+/* number of bytes of each array that are processed per iteration */
+#ifndef BLOCK_SIZE
+#define BLOCK_SIZE 4096
+#endif
+/* if NONTEMPORAL is defined, the arrays are written
+   using non-temporal stores */
+#ifdef NONTEMPORAL
+constexpr bool nontemporal = true;
+#else
+constexpr bool nontemporal = false;
+#endif
+
+/* the arrays of one thread where the kernels continue
+   with the element at offset */
+struct Arrays {
+   double* a;
+   double* b;
+   double* c;
+   std::size_t offset;
+};
+
+/* run the kernel count times for the next block of elements
+   where we wrap around at the end of the arrays of length n */
+void run_blocks(Arrays& arrays, std::size_t n, std::size_t block,
+      StreamKernel kernel, Isa isa, std::size_t count) {
+   std::size_t offset = arrays.offset;
+   while (count-- > 0) {
+      std::size_t len = std::min(block, n - offset);
+      run_stream_kernel(kernel, isa, nontemporal, arrays.a + offset,
+	 arrays.b + offset, arrays.c + offset, len);
+      offset += len;
+      if (offset == n) offset = 0;
+      if (len < block) {
+	 len = block - len;
+	 run_stream_kernel(kernel, isa, nontemporal, arrays.a,
+	    arrays.b, arrays.c, len);
+	 offset = len;
+      }
+   }
+   arrays.offset = offset;
+}
+
+int main() {
+   std::vector<Isa> isas;
+   if (!parse_isas(ISAS, isas) || isas.empty()) {
+      std::cerr << "invalid list of instruction sets: " << ISAS << std::endl;
+      std::exit(1);
+   }
+   std::vector<StreamKernel> kernels;
+   if (!parse_kernels(KERNELS, kernels) || kernels.empty()) {
+      std::cerr << "invalid list of kernels: " << KERNELS << std::endl;
+      std::exit(1);
+   }
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKING, backings) || backings.size() != 1) {
+      std::cerr << "invalid backing: " << BACKING << std::endl;
+      std::exit(1);
+   }
+   Backing backing = backings.front();
+   OutputFormat format;
+   if (!parse_output_format(OUTPUT, format)) {
+      std::cerr << "invalid output format: " << OUTPUT << std::endl;
+      std::exit(1);
+   }
+
+   auto cpus = available_cpus();
+   std::size_t nof_threads = THREADS;
+   if (nof_threads == 0) nof_threads = cpus.size();
+   std::vector<unsigned int> team_cpus;
+   for (std::size_t i = 0; i < nof_threads; ++i) {
+      team_cpus.push_back(cpus[i % cpus.size()]);
+   }
+   ThreadTeam team(team_cpus);
+   std::vector<Arrays> arrays(nof_threads);
+
+   ResultTable table("stream-bandwidth", "memsize", 13, "GiB/s", format);
+   if (table.text()) {
+      fmt::printf("%36s%s\n", "",
+	 "data transfer speeds in GiB/s of all threads");
+      fmt::printf("              ");
+      for (auto isa: isas) {
+	 for (auto kernel: kernels) {
+	    std::string name = std::string(isa_name(isa)) + " " +
+	       kernel_name(kernel);
+	    fmt::printf("%s%s", std::string(36 - name.size(), ' '), name);
+	 }
+      }
+      fmt::printf("\n       memsize");
+      for (std::size_t i = 0; i < isas.size() * kernels.size(); ++i) {
+	 fmt::printf("      median         max      stddev");
+      }
+      fmt::printf("\n");
+   }
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      table.begin_row(memsize);
+      std::size_t n = memsize / sizeof(double);
+      std::size_t block = std::min(n,
+	 std::max(std::size_t{1}, std::size_t{BLOCK_SIZE} / sizeof(double)));
+
+      /* each thread allocates and touches its own arrays
+	 such that they are local to it */
+      bool available = true;
+      team.run([&](unsigned int i) {
+	 auto allocate = [&]() {
+	    double* array = (double*) allocate_buffer(memsize, backing);
+	    if (array) std::fill(array, array + n, 1.0);
+	    return array;
+	 };
+	 arrays[i] = Arrays{allocate(), allocate(), allocate(), 0};
+      });
+      for (auto& a: arrays) {
+	 if (!a.a || !a.b || !a.c) available = false;
+      }
+      if (!available) {
+	 std::cerr << "backing " << BACKING << " is not available" << std::endl;
+	 std::exit(1);
+      }
+
+      for (auto isa: isas) {
+	 for (auto kernel: kernels) {
+	    std::string group = std::string(isa_name(isa)) + " " +
+	       kernel_name(kernel);
+	    if (!isa_supported(isa)) {
+	       table.add_missing(group, "median");
+	       table.add_missing(group, "max");
+	       table.add_missing(group, "stddev");
+	       continue;
+	    }
+	    auto stats = measure([&](std::size_t count) {
+	       WallTime<double> walltime;
+	       team.run([&](unsigned int i) {
+		  run_blocks(arrays[i], n, block, kernel, isa, count);
+	       });
+	       return walltime.elapsed();
+	    }, measurement_parameters());
+	    /* the statistics in ns per iteration are converted into
+	       speeds where the minimal time gives the maximal speed
+	       and the standard deviation is scaled accordingly */
+	    auto volume = static_cast<double>(kernel_bytes(kernel)) *
+	       block * nof_threads;
+	    auto speed = [=](double ns) {
+	       return volume / ns * 1000000000 / (1<<30); /* in GiB/s */
+	    };
+	    auto median = speed(stats.median);
+	    table.add(group, "median", median);
+	    table.add(group, "max", speed(stats.min));
+	    table.add(group, "stddev", median * stats.stddev / stats.median);
+	 }
+      }
+
+      for (auto& a: arrays) {
+	 free_buffer(a.a, memsize, backing);
+	 free_buffer(a.b, memsize, backing);
+	 free_buffer(a.c, memsize, backing);
+      }
+      table.end_row();
+   }
+}
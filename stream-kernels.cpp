@@ -0,0 +1,422 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstring>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+#include "stream-kernels.hpp"
+
+/* this variable must not be declared static */
+volatile double stream_kernels_global; // to defeat optimizations
+
+static constexpr double scalar = 3.0;
+
+static const struct {
+   Isa isa;
+   const char* name;
+} isa_names[] = {
+   {Isa::scalar, "scalar"},
+   {Isa::sse, "sse"},
+   {Isa::avx2, "avx2"},
+   {Isa::avx512, "avx512"},
+};
+
+static const struct {
+   StreamKernel kernel;
+   const char* name;
+   std::size_t bytes;
+} kernel_names[] = {
+   {StreamKernel::read, "read", sizeof(double)},
+   {StreamKernel::write, "write", sizeof(double)},
+   {StreamKernel::copy, "copy", 2 * sizeof(double)},
+   {StreamKernel::triad, "triad", 3 * sizeof(double)},
+};
+
+const char* isa_name(Isa isa) {
+   for (auto& entry: isa_names) {
+      if (entry.isa == isa) return entry.name;
+   }
+   return "?";
+}
+
+bool parse_isas(const char* names, std::vector<Isa>& isas) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 if (len == 4 && std::strncmp(names, "best", len) == 0) {
+	    isas.push_back(best_isa());
+	    found = true;
+	 }
+	 for (auto& entry: isa_names) {
+	    if (found) break;
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       isas.push_back(entry.isa);
+	       found = true;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+bool isa_supported(Isa isa) {
+   switch (isa) {
+      case Isa::scalar:
+	 return true;
+#ifdef __x86_64__
+      case Isa::sse:
+	 return __builtin_cpu_supports("sse2");
+      case Isa::avx2:
+	 return __builtin_cpu_supports("avx2") &&
+	    __builtin_cpu_supports("fma");
+      case Isa::avx512:
+	 return __builtin_cpu_supports("avx512f");
+#endif
+      default:
+	 return false;
+   }
+}
+
+Isa best_isa() {
+   for (auto isa: {Isa::avx512, Isa::avx2, Isa::sse}) {
+      if (isa_supported(isa)) return isa;
+   }
+   return Isa::scalar;
+}
+
+const char* kernel_name(StreamKernel kernel) {
+   for (auto& entry: kernel_names) {
+      if (entry.kernel == kernel) return entry.name;
+   }
+   return "?";
+}
+
+bool parse_kernels(const char* names, std::vector<StreamKernel>& kernels) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 for (auto& entry: kernel_names) {
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       kernels.push_back(entry.kernel);
+	       found = true; break;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+std::size_t kernel_bytes(StreamKernel kernel) {
+   for (auto& entry: kernel_names) {
+      if (entry.kernel == kernel) return entry.bytes;
+   }
+   return 0;
+}
+
+/* store a double, bypassing the caches if nontemporal is true */
+static inline void store(double* p, double value, bool nontemporal) {
+#ifdef __x86_64__
+   if (nontemporal) {
+      long long bits;
+      std::memcpy(&bits, &value, sizeof bits);
+      _mm_stream_si64((long long*) p, bits);
+      return;
+   }
+#endif
+   *p = value;
+}
+
+/* the scalar kernels must not be vectorized by the compiler */
+__attribute__((optimize("no-tree-vectorize")))
+static void scalar_kernel(StreamKernel kernel, bool nontemporal,
+      double* a, const double* b, const double* c, std::size_t n) {
+   double s = scalar;
+   switch (kernel) {
+      case StreamKernel::read: {
+	 /* independent sums to avoid waiting for the latency of adds */
+	 double sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+	 std::size_t i = 0;
+	 for (; i + 4 <= n; i += 4) {
+	    sum0 += b[i]; sum1 += b[i+1]; sum2 += b[i+2]; sum3 += b[i+3];
+	 }
+	 for (; i < n; ++i) sum0 += b[i];
+	 stream_kernels_global = sum0 + sum1 + sum2 + sum3;
+	 break;
+      }
+      case StreamKernel::write:
+	 for (std::size_t i = 0; i < n; ++i) store(a + i, s, nontemporal);
+	 break;
+      case StreamKernel::copy:
+	 for (std::size_t i = 0; i < n; ++i) store(a + i, b[i], nontemporal);
+	 break;
+      case StreamKernel::triad:
+	 for (std::size_t i = 0; i < n; ++i) {
+	    store(a + i, b[i] + s * c[i], nontemporal);
+	 }
+	 break;
+   }
+}
+
+#ifdef __x86_64__
+
+/* number of leading elements that are to be processed by the
+   scalar kernel until a is aligned to the given number of bytes;
+   the remaining elements are processed using aligned stores
+   and unaligned loads as b and c may be aligned differently */
+static inline std::size_t head(const double* a, std::size_t n,
+      std::size_t alignment) {
+   std::size_t misalignment = (std::uintptr_t) a % alignment;
+   std::size_t len = misalignment?
+      (alignment - misalignment) / sizeof(double): 0;
+   return len < n? len: n;
+}
+
+/* the vector kernels are compiled for their instruction set
+   independent of the compiler options and are just called
+   if the CPU supports it; they are written out for each
+   instruction set as functions with a target attribute
+   cannot inline intrinsics into generic code */
+
+__attribute__((target("sse2")))
+static void sse_kernel(StreamKernel kernel, bool nontemporal,
+      double* a, const double* b, const double* c, std::size_t n) {
+   constexpr std::size_t w = 2;
+   std::size_t i = head(a, n, sizeof(__m128d));
+   scalar_kernel(kernel, nontemporal, a, b, c, i);
+   std::size_t end = i + (n - i) / (4 * w) * (4 * w);
+   __m128d s = _mm_set1_pd(scalar);
+   switch (kernel) {
+      case StreamKernel::read: {
+	 __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+	 __m128d sum2 = _mm_setzero_pd(), sum3 = _mm_setzero_pd();
+	 for (; i < end; i += 4 * w) {
+	    sum0 = _mm_add_pd(sum0, _mm_loadu_pd(b + i));
+	    sum1 = _mm_add_pd(sum1, _mm_loadu_pd(b + i + w));
+	    sum2 = _mm_add_pd(sum2, _mm_loadu_pd(b + i + 2 * w));
+	    sum3 = _mm_add_pd(sum3, _mm_loadu_pd(b + i + 3 * w));
+	 }
+	 __m128d sum = _mm_add_pd(_mm_add_pd(sum0, sum1),
+	    _mm_add_pd(sum2, sum3));
+	 double lanes[w]; _mm_storeu_pd(lanes, sum);
+	 stream_kernels_global = lanes[0] + lanes[1];
+	 break;
+      }
+      case StreamKernel::write:
+	 if (nontemporal) {
+	    for (; i < end; i += w) _mm_stream_pd(a + i, s);
+	 } else {
+	    for (; i < end; i += w) _mm_store_pd(a + i, s);
+	 }
+	 break;
+      case StreamKernel::copy:
+	 if (nontemporal) {
+	    for (; i < end; i += w) _mm_stream_pd(a + i, _mm_loadu_pd(b + i));
+	 } else {
+	    for (; i < end; i += w) _mm_store_pd(a + i, _mm_loadu_pd(b + i));
+	 }
+	 break;
+      case StreamKernel::triad:
+	 if (nontemporal) {
+	    for (; i < end; i += w) {
+	       _mm_stream_pd(a + i, _mm_add_pd(_mm_loadu_pd(b + i),
+		  _mm_mul_pd(s, _mm_loadu_pd(c + i))));
+	    }
+	 } else {
+	    for (; i < end; i += w) {
+	       _mm_store_pd(a + i, _mm_add_pd(_mm_loadu_pd(b + i),
+		  _mm_mul_pd(s, _mm_loadu_pd(c + i))));
+	    }
+	 }
+	 break;
+   }
+   scalar_kernel(kernel, nontemporal, a + i, b + i, c + i, n - i);
+   if (nontemporal) _mm_sfence();
+}
+
+__attribute__((target("avx2,fma")))
+static void avx2_kernel(StreamKernel kernel, bool nontemporal,
+      double* a, const double* b, const double* c, std::size_t n) {
+   constexpr std::size_t w = 4;
+   std::size_t i = head(a, n, sizeof(__m256d));
+   scalar_kernel(kernel, nontemporal, a, b, c, i);
+   std::size_t end = i + (n - i) / (4 * w) * (4 * w);
+   __m256d s = _mm256_set1_pd(scalar);
+   switch (kernel) {
+      case StreamKernel::read: {
+	 __m256d sum0 = _mm256_setzero_pd(), sum1 = _mm256_setzero_pd();
+	 __m256d sum2 = _mm256_setzero_pd(), sum3 = _mm256_setzero_pd();
+	 for (; i < end; i += 4 * w) {
+	    sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(b + i));
+	    sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(b + i + w));
+	    sum2 = _mm256_add_pd(sum2, _mm256_loadu_pd(b + i + 2 * w));
+	    sum3 = _mm256_add_pd(sum3, _mm256_loadu_pd(b + i + 3 * w));
+	 }
+	 __m256d sum = _mm256_add_pd(_mm256_add_pd(sum0, sum1),
+	    _mm256_add_pd(sum2, sum3));
+	 double lanes[w]; _mm256_storeu_pd(lanes, sum);
+	 stream_kernels_global = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	 break;
+      }
+      case StreamKernel::write:
+	 if (nontemporal) {
+	    for (; i < end; i += w) _mm256_stream_pd(a + i, s);
+	 } else {
+	    for (; i < end; i += w) _mm256_store_pd(a + i, s);
+	 }
+	 break;
+      case StreamKernel::copy:
+	 if (nontemporal) {
+	    for (; i < end; i += w) {
+	       _mm256_stream_pd(a + i, _mm256_loadu_pd(b + i));
+	    }
+	 } else {
+	    for (; i < end; i += w) {
+	       _mm256_store_pd(a + i, _mm256_loadu_pd(b + i));
+	    }
+	 }
+	 break;
+      case StreamKernel::triad:
+	 if (nontemporal) {
+	    for (; i < end; i += w) {
+	       _mm256_stream_pd(a + i, _mm256_fmadd_pd(s,
+		  _mm256_loadu_pd(c + i), _mm256_loadu_pd(b + i)));
+	    }
+	 } else {
+	    for (; i < end; i += w) {
+	       _mm256_store_pd(a + i, _mm256_fmadd_pd(s,
+		  _mm256_loadu_pd(c + i), _mm256_loadu_pd(b + i)));
+	    }
+	 }
+	 break;
+   }
+   /* leave the upper halves clean before we continue with the
+      non-VEX-encoded scalar kernel, as GCC does not do this for us
+      in functions with a target attribute */
+   _mm256_zeroupper();
+   scalar_kernel(kernel, nontemporal, a + i, b + i, c + i, n - i);
+   if (nontemporal) _mm_sfence();
+}
+
+__attribute__((target("avx512f")))
+static void avx512_kernel(StreamKernel kernel, bool nontemporal,
+      double* a, const double* b, const double* c, std::size_t n) {
+   constexpr std::size_t w = 8;
+   std::size_t i = head(a, n, sizeof(__m512d));
+   scalar_kernel(kernel, nontemporal, a, b, c, i);
+   std::size_t end = i + (n - i) / (4 * w) * (4 * w);
+   __m512d s = _mm512_set1_pd(scalar);
+   switch (kernel) {
+      case StreamKernel::read: {
+	 __m512d sum0 = _mm512_setzero_pd(), sum1 = _mm512_setzero_pd();
+	 __m512d sum2 = _mm512_setzero_pd(), sum3 = _mm512_setzero_pd();
+	 for (; i < end; i += 4 * w) {
+	    sum0 = _mm512_add_pd(sum0, _mm512_loadu_pd(b + i));
+	    sum1 = _mm512_add_pd(sum1, _mm512_loadu_pd(b + i + w));
+	    sum2 = _mm512_add_pd(sum2, _mm512_loadu_pd(b + i + 2 * w));
+	    sum3 = _mm512_add_pd(sum3, _mm512_loadu_pd(b + i + 3 * w));
+	 }
+	 __m512d sum = _mm512_add_pd(_mm512_add_pd(sum0, sum1),
+	    _mm512_add_pd(sum2, sum3));
+	 double lanes[w]; _mm512_storeu_pd(lanes, sum);
+	 stream_kernels_global = lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+	    lanes[4] + lanes[5] + lanes[6] + lanes[7];
+	 break;
+      }
+      case StreamKernel::write:
+	 if (nontemporal) {
+	    for (; i < end; i += w) _mm512_stream_pd(a + i, s);
+	 } else {
+	    for (; i < end; i += w) _mm512_store_pd(a + i, s);
+	 }
+	 break;
+      case StreamKernel::copy:
+	 if (nontemporal) {
+	    for (; i < end; i += w) {
+	       _mm512_stream_pd(a + i, _mm512_loadu_pd(b + i));
+	    }
+	 } else {
+	    for (; i < end; i += w) {
+	       _mm512_store_pd(a + i, _mm512_loadu_pd(b + i));
+	    }
+	 }
+	 break;
+      case StreamKernel::triad:
+	 if (nontemporal) {
+	    for (; i < end; i += w) {
+	       _mm512_stream_pd(a + i, _mm512_fmadd_pd(s,
+		  _mm512_loadu_pd(c + i), _mm512_loadu_pd(b + i)));
+	    }
+	 } else {
+	    for (; i < end; i += w) {
+	       _mm512_store_pd(a + i, _mm512_fmadd_pd(s,
+		  _mm512_loadu_pd(c + i), _mm512_loadu_pd(b + i)));
+	    }
+	 }
+	 break;
+   }
+   _mm256_zeroupper();
+   scalar_kernel(kernel, nontemporal, a + i, b + i, c + i, n - i);
+   if (nontemporal) _mm_sfence();
+}
+
+#endif
+
+void run_stream_kernel(StreamKernel kernel, Isa isa, bool nontemporal,
+      double* a, const double* b, const double* c, std::size_t n) {
+   switch (isa) {
+#ifdef __x86_64__
+      case Isa::sse:
+	 sse_kernel(kernel, nontemporal, a, b, c, n); break;
+      case Isa::avx2:
+	 avx2_kernel(kernel, nontemporal, a, b, c, n); break;
+      case Isa::avx512:
+	 avx512_kernel(kernel, nontemporal, a, b, c, n); break;
+#endif
+      default:
+	 scalar_kernel(kernel, nontemporal, a, b, c, n);
+	 if (nontemporal) {
+#ifdef __x86_64__
+	    _mm_sfence();
+#endif
+	 }
+	 break;
+   }
+}
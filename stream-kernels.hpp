@@ -0,0 +1,83 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef STREAM_KERNELS_HPP
+#define STREAM_KERNELS_HPP
+
+#include <cstddef>
+#include <vector>
+
+/* instruction set extensions the streaming kernels are available for */
+enum class Isa {
+   scalar,	/* one double per instruction */
+   sse,		/* SSE2 with 128-bit vectors */
+   avx2,	/* AVX2 and FMA with 256-bit vectors */
+   avx512,	/* AVX-512F with 512-bit vectors */
+};
+
+/* streaming kernels in the style of STREAM where s is a scalar */
+enum class StreamKernel {
+   read,	/* sum += b[i] */
+   write,	/* a[i] = s */
+   copy,	/* a[i] = b[i] */
+   triad,	/* a[i] = b[i] + s * c[i] */
+};
+
+/* return the short name of an instruction set as used in the output,
+   i.e. one of "scalar", "sse", "avx2", or "avx512" */
+const char* isa_name(Isa isa);
+
+/* parse a blank- or comma-separated list of instruction set names
+   where "best" selects the best supported instruction set;
+   false is returned if an unknown name is encountered */
+bool parse_isas(const char* names, std::vector<Isa>& isas);
+
+/* return true if the given instruction set is supported
+   by the compiler and the CPU we are running on */
+bool isa_supported(Isa isa);
+
+/* return the best supported instruction set */
+Isa best_isa();
+
+/* return the name of a kernel, e.g. "triad" */
+const char* kernel_name(StreamKernel kernel);
+
+/* parse a blank- or comma-separated list of kernel names;
+   false is returned if an unknown name is encountered */
+bool parse_kernels(const char* names, std::vector<StreamKernel>& kernels);
+
+/* return the number of bytes that are read or written by the kernel
+   per element, not counting write-allocate traffic */
+std::size_t kernel_bytes(StreamKernel kernel);
+
+/* run the given kernel for the elements 0 to n-1 of the arrays
+   a, b, and c using the given instruction set which must be supported;
+   if nontemporal is true, a is written with non-temporal stores
+   that bypass the caches;
+   the arrays need not be aligned */
+void run_stream_kernel(StreamKernel kernel, Isa isa, bool nontemporal,
+   double* a, const double* b, const double* c, std::size_t n);
+
+#endif
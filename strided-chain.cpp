@@ -0,0 +1,101 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include "strided-chain.hpp"
+#include "uniform-int-distribution.hpp"
+
+/* return a random permutation of [0..len) */
+static std::vector<std::size_t> random_order(std::size_t len,
+      std::uint64_t seed) {
+   UniformIntDistribution uniform(seed);
+   std::vector<std::size_t> order(len);
+   for (std::size_t i = 0; i < len; ++i) {
+      order[i] = i;
+   }
+   for (std::size_t i = len; i > 1; --i) {
+      std::swap(order[i - 1], order[uniform.draw(i)]);
+   }
+   return order;
+}
+
+void init_strided_chain(void** memory, std::size_t count,
+      std::size_t stride, std::uint64_t seed) {
+   std::size_t words = stride / sizeof(void*);
+   auto order = random_order(count, seed);
+   for (std::size_t i = 0; i < count; ++i) {
+      std::size_t next = order[(i + 1) % count];
+      memory[order[i] * words] = (void*) &memory[next * words];
+   }
+}
+
+void** create_strided_chain(std::size_t count, std::size_t stride,
+      Backing backing, std::uint64_t seed) {
+   void** memory = (void**) allocate_buffer(count * stride, backing);
+   if (memory) init_strided_chain(memory, count, stride, seed);
+   return memory;
+}
+
+void** create_pair_chain(std::size_t size, std::size_t block,
+      std::size_t offset, Backing backing, std::uint64_t seed) {
+   void** memory = (void**) allocate_buffer(size, backing);
+   if (!memory) return nullptr;
+   std::size_t words = block / sizeof(void*);
+   std::size_t second = offset / sizeof(void*);
+   std::size_t blocks = size / block;
+   auto order = random_order(blocks, seed);
+   for (std::size_t i = 0; i < blocks; ++i) {
+      void** first = &memory[order[i] * words];
+      void** next = &memory[order[(i + 1) % blocks] * words];
+      first[0] = (void*) &first[second];
+      first[second] = (void*) next;
+   }
+   return memory;
+}
+
+void init_page_chain(void** memory, std::size_t pages,
+      std::size_t page_size, std::size_t line_size, std::uint64_t seed) {
+   UniformIntDistribution uniform(seed);
+   std::size_t lines = page_size / line_size;
+   std::vector<void**> elements(pages);
+   for (std::size_t i = 0; i < pages; ++i) {
+      std::size_t offset = i * page_size + uniform.draw(lines) * line_size;
+      elements[i] = &memory[offset / sizeof(void*)];
+   }
+   /* the chain has to start at the beginning of the buffer */
+   elements[0] = memory;
+   auto order = random_order(pages, seed? seed + 1: 0);
+   for (std::size_t i = 0; i < pages; ++i) {
+      *elements[order[i]] = (void*) elements[order[(i + 1) % pages]];
+   }
+}
+
+void** create_page_chain(std::size_t pages, std::size_t page_size,
+      std::size_t line_size, Backing backing, std::uint64_t seed) {
+   void** memory = (void**) allocate_buffer(pages * page_size, backing);
+   if (memory) init_page_chain(memory, pages, page_size, line_size, seed);
+   return memory;
+}
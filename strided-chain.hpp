@@ -0,0 +1,79 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef STRIDED_CHAIN_HPP
+#define STRIDED_CHAIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+
+/* fill the given memory section of count * stride bytes with
+   a cyclic pointer chain of count elements that are stride bytes
+   apart and visited in a randomized order */
+void init_strided_chain(void** memory, std::size_t count,
+   std::size_t stride, std::uint64_t seed = chase_defaults::seed);
+
+/* create a cyclic pointer chain of count elements that are
+   stride bytes apart and visited in a randomized order;
+   if stride is a multiple of the number of sets of a cache times
+   its line size, all elements are mapped to the same set;
+   the buffer of count * stride bytes is to be released
+   using free_buffer; nullptr is returned if the backing
+   is not available */
+void** create_strided_chain(std::size_t count, std::size_t stride,
+   Backing backing, std::uint64_t seed = chase_defaults::seed);
+
+/* create a cyclic pointer chain that visits all blocks of
+   the given size in a buffer of size bytes in a randomized order
+   where within each block the word at the beginning of the block
+   is followed by the word at the given offset
+   where 0 < offset < block;
+   the buffer is to be released using free_buffer;
+   nullptr is returned if the backing is not available */
+void** create_pair_chain(std::size_t size, std::size_t block,
+   std::size_t offset, Backing backing,
+   std::uint64_t seed = chase_defaults::seed);
+
+/* fill the given memory section of pages * page_size bytes with
+   a cyclic pointer chain that visits one cache line of the given
+   size per page in a randomized order of the pages where the line
+   within each page is randomized as well; the chain starts at the
+   beginning of the memory section */
+void init_page_chain(void** memory, std::size_t pages,
+   std::size_t page_size, std::size_t line_size,
+   std::uint64_t seed = chase_defaults::seed);
+
+/* create a cyclic pointer chain that visits one cache line of
+   the given size per page in a randomized order of the pages
+   where the line within each page is randomized as well;
+   the buffer of pages * page_size bytes is to be released using
+   free_buffer; nullptr is returned if the backing is not available */
+void** create_page_chain(std::size_t pages, std::size_t page_size,
+   std::size_t line_size, Backing backing,
+   std::uint64_t seed = chase_defaults::seed);
+
+#endif
@@ -0,0 +1,505 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* variant of random-chase where the chain is not formed by single
+   pointers but by lookups in or steps through linked data structures
+   like lists, maps, hash tables, and B-trees, each with individual heap
+   allocations aligned to cache lines and with nodes that are placed
+   contiguously into an arena */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "aligned-allocator.hpp"
+#include "arena-allocator.hpp"
+#include "chase-pointers.hpp"
+#include "measurement.hpp"
+#include "memory-arena.hpp"
+#include "memory-backing.hpp"
+#include "random-chain.hpp"
+#include "static-btree.hpp"
+#include "uniform-int-distribution.hpp"
+#include "utility-config.hpp"
+#include "walltime.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 4096
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of data structures, out of "list", "map", "umap"
+   (std::unordered_map), and "btree" */
+#ifndef STRUCTURES
+#define STRUCTURES "list map umap btree"
+#endif
+/* list of allocators, out of "aligned" (heap allocations aligned
+   to cache lines) and "arena" (all nodes placed contiguously into
+   an arena) */
+#ifndef ALLOCATORS
+#define ALLOCATORS "aligned arena"
+#endif
+/* list of element sizes in cache lines, 1 to 4 */
+#ifndef LINES
+#define LINES "1"
+#endif
+/* backing of the arena, see memory-backing.hpp */
+#ifndef BACKING
+#define BACKING "heap"
+#endif
+
+/* this variable must not be declared static */
+volatile std::uint64_t structure_chase_global; // to defeat optimizations
+
+enum class Structure {list, map, umap, btree};
+enum class Allocator {aligned, arena};
+
+template<typename T>
+struct NamedValue {
+   T value;
+   const char* name;
+};
+
+static const NamedValue<Structure> structure_names[] = {
+   {Structure::list, "list"},
+   {Structure::map, "map"},
+   {Structure::umap, "umap"},
+   {Structure::btree, "btree"},
+};
+
+static const NamedValue<Allocator> allocator_names[] = {
+   {Allocator::aligned, "aligned"},
+   {Allocator::arena, "arena"},
+};
+
+/* parse a blank- or comma-separated list of names of the given table;
+   false is returned if an unknown name is encountered */
+template<typename T, std::size_t N>
+static bool parse_names(const char* names, const NamedValue<T> (&table)[N],
+      std::vector<T>& values) {
+   const char* delimiters = " \t,";
+   while (*names) {
+      std::size_t len = std::strcspn(names, delimiters);
+      if (len > 0) {
+	 bool found = false;
+	 for (auto& entry: table) {
+	    if (std::strlen(entry.name) == len &&
+		  std::strncmp(entry.name, names, len) == 0) {
+	       values.push_back(entry.value);
+	       found = true; break;
+	    }
+	 }
+	 if (!found) return false;
+	 names += len;
+      } else {
+	 ++names;
+      }
+   }
+   return true;
+}
+
+template<typename T, std::size_t N>
+static const char* name_of(const NamedValue<T> (&table)[N], T value) {
+   for (auto& entry: table) {
+      if (entry.value == value) return entry.name;
+   }
+   return "?";
+}
+
+using Key = std::uint64_t;
+constexpr std::size_t line_size = 64;
+constexpr std::size_t max_lines = 4;
+
+/* element of the given number of cache lines of which
+   just the first word is used; it is aligned to a cache line
+   such that it does not straddle more lines than it occupies */
+template<std::size_t Lines>
+struct alignas(line_size) Element {
+   Key next;	/* key of the next element of the chain */
+   char payload[Lines * line_size - sizeof(Key)];
+};
+
+/* keys 0 to n-1 in a random order of insertion and
+   for each key its successor in a cycle through all keys */
+struct Chain {
+   std::vector<Key> order;
+   std::vector<Key> next;
+
+   Chain(std::size_t n) : order(n), next(n) {
+      UniformIntDistribution uniform(SEED);
+      for (std::size_t i = 0; i < n; ++i) {
+	 order[i] = i; next[i] = i;
+      }
+      for (std::size_t i = n; i > 1; --i) {
+	 std::swap(order[i - 1], order[uniform.draw(i)]);
+      }
+      /* Sattolo's algorithm, see random-chain.cpp */
+      for (std::size_t i = n - 1; i > 0; --i) {
+	 std::swap(next[i], next[uniform.draw(i)]);
+      }
+   }
+};
+
+template<typename Alloc, typename T>
+using Rebind = typename std::allocator_traits<Alloc>::
+   template rebind_alloc<T>;
+
+template<std::size_t Lines, typename Alloc>
+using List = std::list<Element<Lines>, Rebind<Alloc, Element<Lines>>>;
+template<std::size_t Lines, typename Alloc>
+using Map = std::map<Key, Element<Lines>, std::less<Key>,
+   Rebind<Alloc, std::pair<const Key, Element<Lines>>>>;
+template<std::size_t Lines, typename Alloc>
+using UnorderedMap = std::unordered_map<Key, Element<Lines>,
+   std::hash<Key>, std::equal_to<Key>,
+   Rebind<Alloc, std::pair<const Key, Element<Lines>>>>;
+/* in case of the B-tree, the nodes have the size of an element */
+template<std::size_t Lines, typename Alloc>
+using BTree = StaticBTree<Lines * line_size, Alloc, line_size>;
+
+/* allocator that takes its memory from the heap like AlignedAllocator
+   and records the size of the largest object that is allocated
+   individually, i.e. the size of a node of the container */
+template<typename T>
+class NodeSizeProbe {
+   public:
+      using value_type = T;
+
+      NodeSizeProbe(std::size_t& node_size) : node_size(&node_size) {
+      }
+      template<typename U>
+      NodeSizeProbe(const NodeSizeProbe<U>& other) :
+	    node_size(other.node_size) {
+      }
+
+      T* allocate(std::size_t n) {
+	 if (n == 1 && sizeof(T) > *node_size) *node_size = sizeof(T);
+	 return AlignedAllocator<T>().allocate(n);
+      }
+      void deallocate(T* p, std::size_t n) {
+	 AlignedAllocator<T>().deallocate(p, n);
+      }
+
+      template<typename U>
+      bool operator==(const NodeSizeProbe<U>& other) const {
+	 return node_size == other.node_size;
+      }
+      template<typename U>
+      bool operator!=(const NodeSizeProbe<U>& other) const {
+	 return node_size != other.node_size;
+      }
+
+   private:
+      template<typename U> friend class NodeSizeProbe;
+      std::size_t* node_size;
+};
+
+/* size of a node of the given data structure including
+   the padding the alignment of the elements requires */
+template<std::size_t Lines>
+static std::size_t node_size(Structure structure) {
+   std::size_t size = 0;
+   NodeSizeProbe<char> alloc(size);
+   switch (structure) {
+      case Structure::list: {
+	 List<Lines, NodeSizeProbe<char>> list(alloc);
+	 list.emplace_back();
+	 break;
+      }
+      case Structure::map: {
+	 Map<Lines, NodeSizeProbe<char>> map(alloc);
+	 map[0];
+	 break;
+      }
+      case Structure::umap: {
+	 UnorderedMap<Lines, NodeSizeProbe<char>> map(1, std::hash<Key>(),
+	    std::equal_to<Key>(), alloc);
+	 map[0];
+	 break;
+      }
+      default: {
+	 typename BTree<Lines, NodeSizeProbe<char>>::Pairs pairs(1);
+	 BTree<Lines, NodeSizeProbe<char>> tree(pairs, alloc);
+	 break;
+      }
+   }
+   return size;
+}
+
+/* upper bound of the size of the given data structure with n elements
+   in an arena: the B-tree has less nodes than elements, the
+   unordered map has in addition a bucket array which is sized to
+   the next prime above n, and each kind of allocation may be
+   preceded by the padding to its alignment */
+static std::size_t arena_size(Structure structure, std::size_t lines,
+      std::size_t n) {
+   std::size_t size;
+   switch (lines) {
+      case 1: size = node_size<1>(structure); break;
+      case 2: size = node_size<2>(structure); break;
+      case 3: size = node_size<3>(structure); break;
+      default: size = node_size<4>(structure); break;
+   }
+   std::size_t bytes = n * size + 2 * max_lines * line_size;
+   if (structure == Structure::umap) {
+      bytes += 2 * n * sizeof(void*);
+   }
+   return bytes;
+}
+
+/* measure chained lookups where lookup(key) returns the next key */
+template<typename Lookup>
+static Statistics measure_lookups(Lookup lookup) {
+   return measure([&](std::size_t count) {
+      Key key = 0;
+      WallTime<double> walltime;
+      while (count-- > 0) {
+	 key = lookup(key);
+      }
+      auto elapsed = walltime.elapsed();
+      structure_chase_global = key;
+      return elapsed;
+   }, measurement_parameters());
+}
+
+/* the list is sorted by key after its construction such that
+   its order is unrelated to the order of allocation */
+template<std::size_t Lines, typename Alloc>
+static Statistics chase_list(const Chain& chain, const Alloc& alloc) {
+   List<Lines, Alloc> list(alloc);
+   for (auto key: chain.order) {
+      list.emplace_back();
+      list.back().next = key;
+   }
+   list.sort([](const Element<Lines>& e1, const Element<Lines>& e2) {
+      return e1.next < e2.next;
+   });
+   auto it = list.begin();
+   return measure([&](std::size_t count) {
+      WallTime<double> walltime;
+      while (count-- > 0) {
+	 if (++it == list.end()) it = list.begin();
+      }
+      auto elapsed = walltime.elapsed();
+      structure_chase_global = it->next;
+      return elapsed;
+   }, measurement_parameters());
+}
+
+template<std::size_t Lines, typename Alloc>
+static Statistics chase_map(const Chain& chain, const Alloc& alloc) {
+   Map<Lines, Alloc> map(alloc);
+   for (auto key: chain.order) {
+      map[key].next = chain.next[key];
+   }
+   return measure_lookups([&](Key key) {
+      return map.find(key)->second.next;
+   });
+}
+
+template<std::size_t Lines, typename Alloc>
+static Statistics chase_umap(const Chain& chain, const Alloc& alloc) {
+   UnorderedMap<Lines, Alloc> map(chain.order.size(), std::hash<Key>(),
+      std::equal_to<Key>(), alloc);
+   for (auto key: chain.order) {
+      map[key].next = chain.next[key];
+   }
+   return measure_lookups([&](Key key) {
+      return map.find(key)->second.next;
+   });
+}
+
+template<std::size_t Lines, typename Alloc>
+static Statistics chase_btree(const Chain& chain, const Alloc& alloc) {
+   using Tree = BTree<Lines, Alloc>;
+   typename Tree::Pairs pairs;
+   for (std::size_t key = 0; key < chain.next.size(); ++key) {
+      pairs.push_back(std::make_pair(key, chain.next[key]));
+   }
+   Tree tree(pairs, alloc);
+   return measure_lookups([&](Key key) {
+      return tree.find(key);
+   });
+}
+
+template<std::size_t Lines, typename Alloc>
+static Statistics chase_structure(Structure structure,
+      const Chain& chain, const Alloc& alloc) {
+   switch (structure) {
+      case Structure::list: return chase_list<Lines>(chain, alloc);
+      case Structure::map: return chase_map<Lines>(chain, alloc);
+      case Structure::umap: return chase_umap<Lines>(chain, alloc);
+      default: return chase_btree<Lines>(chain, alloc);
+   }
+}
+
+template<typename Alloc>
+static Statistics chase_structure(Structure structure, std::size_t lines,
+      const Chain& chain, const Alloc& alloc) {
+   switch (lines) {
+      case 1: return chase_structure<1>(structure, chain, alloc);
+      case 2: return chase_structure<2>(structure, chain, alloc);
+      case 3: return chase_structure<3>(structure, chain, alloc);
+      default: return chase_structure<4>(structure, chain, alloc);
+   }
+}
+
+int main() {
+   std::vector<Structure> structures;
+   if (!parse_names(STRUCTURES, structure_names, structures) ||
+	 structures.empty()) {
+      std::cerr << "invalid list of structures: " << STRUCTURES << std::endl;
+      std::exit(1);
+   }
+   std::vector<Allocator> allocators;
+   if (!parse_names(ALLOCATORS, allocator_names, allocators) ||
+	 allocators.empty()) {
+      std::cerr << "invalid list of allocators: " << ALLOCATORS << std::endl;
+      std::exit(1);
+   }
+   std::vector<std::size_t> lines;
+   for (const char* s = LINES; *s; ) {
+      char* end;
+      std::size_t value = std::strtoul(s, &end, 10);
+      if (end == s) {
+	 ++s; continue;
+      }
+      if (value < 1 || value > max_lines) {
+	 std::cerr << "invalid list of lines: " << LINES << std::endl;
+	 std::exit(1);
+      }
+      lines.push_back(value); s = end;
+   }
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKING, backings) || backings.size() != 1) {
+      std::cerr << "invalid backing: " << BACKING << std::endl;
+      std::exit(1);
+   }
+
+   /* the arena for the random chain and that for the nodes
+      of the largest of the data structures */
+   std::size_t node_arena_size = 0;
+   for (auto nof_lines: lines) {
+      std::size_t n = MAX_SIZE / (nof_lines * line_size);
+      for (auto structure: structures) {
+	 node_arena_size = std::max(node_arena_size,
+	    arena_size(structure, nof_lines, n));
+      }
+   }
+   MemoryArena chain_arena(MAX_SIZE, Backing::heap, LOCK_MEMORY);
+   MemoryArena node_arena(node_arena_size, backings[0], LOCK_MEMORY);
+   if (!node_arena.available()) {
+      std::cerr << "backing " << BACKING << " is not available" << std::endl;
+      std::exit(1);
+   }
+   if (LOCK_MEMORY && (!chain_arena.locked() || !node_arena.locked())) {
+      std::cerr << "unable to lock memory" << std::endl;
+   }
+
+   fmt::printf("%30s%s\n", "",
+      "ns per access of the chain and per lookup or step");
+   fmt::printf("       memsize  %12s", "chain");
+   for (auto nof_lines: lines) {
+      for (auto structure: structures) {
+	 for (auto allocator: allocators) {
+	    std::string name = std::string(name_of(structure_names,
+	       structure)) + "/" + name_of(allocator_names, allocator) +
+	       "/" + std::to_string(nof_lines);
+	    fmt::printf("  %13s", name);
+	 }
+      }
+   }
+   fmt::printf("\n");
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      fmt::printf(" %13u", memsize);
+      void** memory = chain_arena.memory();
+      init_random_chain(memory, memsize, SEED, CHAIN_THREADS);
+      auto stats = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, measurement_parameters());
+      fmt::printf("  %12.5lf", stats.median);
+      std::cout.flush();
+
+      for (auto nof_lines: lines) {
+	 std::size_t n = memsize / (nof_lines * line_size);
+	 if (n < 2) {
+	    for (std::size_t i = 0;
+		  i < structures.size() * allocators.size(); ++i) {
+	       fmt::printf("  %13s", "-");
+	    }
+	    continue;
+	 }
+	 Chain chain(n);
+	 for (auto structure: structures) {
+	    for (auto allocator: allocators) {
+	       if (allocator == Allocator::arena) {
+		  node_arena.reset();
+		  try {
+		     stats = chase_structure(structure, nof_lines, chain,
+			ArenaAllocator<char>(node_arena));
+		  } catch (std::bad_alloc&) {
+		     /* should not happen as the arena is sized
+			for the largest data structure */
+		     fmt::printf("  %13s", "-");
+		     std::cout.flush();
+		     continue;
+		  }
+	       } else {
+		  stats = chase_structure(structure, nof_lines, chain,
+		     AlignedAllocator<char>());
+	       }
+	       fmt::printf("  %13.5lf", stats.median);
+	       std::cout.flush();
+	    }
+	 }
+      }
+      fmt::printf("\n"); std::cout.flush();
+   }
+}
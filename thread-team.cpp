@@ -0,0 +1,67 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "cpu-affinity.hpp"
+#include "thread-team.hpp"
+
+ThreadTeam::ThreadTeam(const std::vector<unsigned int>& cpus) :
+      nof_members(cpus.empty()? 1: cpus.size()), current(nullptr),
+      generation(0), finished(0), stop(false) {
+   if (!cpus.empty()) pin_thread(cpus[0]);
+   for (std::size_t i = 1; i < nof_members; ++i) {
+      unsigned int cpu = cpus[i];
+      threads.push_back(std::thread([=]() {
+	 pin_thread(cpu);
+	 std::size_t seen = 0;
+	 for(;;) {
+	    std::size_t gen;
+	    while ((gen = generation.load(std::memory_order_acquire)) == seen) {
+	       if (stop.load(std::memory_order_relaxed)) return;
+	       std::this_thread::yield();
+	    }
+	    seen = gen;
+	    (*current)(i);
+	    finished.fetch_add(1, std::memory_order_release);
+	 }
+      }));
+   }
+}
+
+ThreadTeam::~ThreadTeam() {
+   stop.store(true);
+   for (auto& thread: threads) {
+      thread.join();
+   }
+}
+
+void ThreadTeam::run(const std::function<void(unsigned int)>& task) {
+   current = &task;
+   finished.store(0, std::memory_order_relaxed);
+   generation.fetch_add(1, std::memory_order_release);
+   task(0);
+   while (finished.load(std::memory_order_acquire) < nof_members - 1) {
+      std::this_thread::yield();
+   }
+}
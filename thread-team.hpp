@@ -0,0 +1,63 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef THREAD_TEAM_HPP
+#define THREAD_TEAM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/* team of threads where the i-th member is pinned to the i-th
+   of the given CPUs; member 0 is the calling thread itself
+   which remains pinned after the construction;
+   the other members spin while they are waiting for a task
+   such that all members start a task almost simultaneously */
+class ThreadTeam {
+   public:
+      ThreadTeam(const std::vector<unsigned int>& cpus);
+      ~ThreadTeam();
+      ThreadTeam(const ThreadTeam&) = delete;
+      ThreadTeam& operator=(const ThreadTeam&) = delete;
+
+      /* number of members */
+      std::size_t size() const { return nof_members; }
+
+      /* run task(i) on each member i and return
+	 when all of them are finished */
+      void run(const std::function<void(unsigned int)>& task);
+
+   private:
+      std::size_t nof_members;
+      std::vector<std::thread> threads;
+      const std::function<void(unsigned int)>* current;
+      std::atomic<std::size_t> generation;
+      std::atomic<std::size_t> finished;
+      std::atomic<bool> stop;
+};
+
+#endif
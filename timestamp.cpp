@@ -0,0 +1,47 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "timestamp.hpp"
+#include "walltime.hpp"
+
+double timestamp_frequency(double seconds) {
+   WallTime<double> walltime;
+   std::uint64_t start = read_timestamp();
+   double elapsed;
+   while ((elapsed = walltime.elapsed()) < seconds)
+      ;
+   std::uint64_t end = read_timestamp();
+   return (end - start) / (elapsed * 1000000000);
+}
+
+double timestamp_overhead(unsigned int samples) {
+   std::uint64_t overhead = ~std::uint64_t{0};
+   for (unsigned int i = 0; i < samples; ++i) {
+      std::uint64_t start = read_timestamp();
+      std::uint64_t end = read_timestamp();
+      if (end - start < overhead) overhead = end - start;
+   }
+   return overhead;
+}
@@ -0,0 +1,62 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef TIMESTAMP_HPP
+#define TIMESTAMP_HPP
+
+#include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* return the current value of a fine-grained timestamp counter:
+   on x86 processors, rdtscp is used which waits for all preceding
+   instructions (including loads) to be completed and returns the
+   time stamp counter which runs at a constant reference frequency,
+   the subsequent lfence keeps later instructions from starting early;
+   otherwise we fall back to a steady clock in ns */
+inline std::uint64_t read_timestamp() {
+#if defined(__x86_64__) || defined(__i386__)
+   unsigned int aux;
+   std::uint64_t timestamp = __rdtscp(&aux);
+   _mm_lfence();
+   return timestamp;
+#else
+   using namespace std::chrono;
+   return duration_cast<nanoseconds>(
+      steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/* return the number of timestamp ticks per ns, calibrated
+   against WallTime for the given number of seconds */
+double timestamp_frequency(double seconds = 0.05);
+
+/* return the minimal number of ticks between two
+   subsequent invocations of read_timestamp */
+double timestamp_overhead(unsigned int samples = 10000);
+
+#endif
@@ -0,0 +1,168 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* utility that measures the reach of the TLBs and the cost of
+   page walks by chasing chains that visit one cache line per page;
+   to separate TLB from cache effects, the access times are
+   compared with those of a compact chain of as many cache lines */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "adaptive-sweep.hpp"
+#include "chase-pointers.hpp"
+#include "measurement.hpp"
+#include "memory-backing.hpp"
+#include "strided-chain.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+/* range of the number of pages */
+#ifndef MIN_PAGES
+#define MIN_PAGES 1
+#endif
+#ifndef MAX_PAGES
+#define MAX_PAGES (std::size_t{1}<<14)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of backings, see memory-backing.hpp for the supported names */
+#ifndef BACKINGS
+#define BACKINGS "4k 2m"
+#endif
+/* maximal size of the mapping for one chain which limits the
+   number of pages for huge pages */
+#ifndef MAX_MEMORY
+#define MAX_MEMORY (std::size_t{1}<<30)
+#endif
+#ifndef LINE_SIZE
+#define LINE_SIZE 64
+#endif
+/* parameters for the detection of the plateaus, see cache-levels */
+#ifndef TOLERANCE
+#define TOLERANCE 0.1
+#endif
+#ifndef MIN_SPAN
+#define MIN_SPAN 1.5
+#endif
+#ifndef MIN_STEP
+#define MIN_STEP 1.3
+#endif
+
+int main() {
+   std::vector<Backing> backings;
+   if (!parse_backings(BACKINGS, backings) || backings.empty()) {
+      std::cerr << "invalid list of backings: " << BACKINGS << std::endl;
+      std::exit(1);
+   }
+
+   fmt::printf("          %10s", "");
+   for (auto backing: backings) {
+      std::string name = backing_name(backing);
+      fmt::printf("%s%s", std::string(48 - name.size(), ' '), name);
+   }
+   fmt::printf("\n     pages         ref");
+   for (std::size_t i = 0; i < backings.size(); ++i) {
+      fmt::printf("      median         min      stddev        +tlb");
+   }
+   fmt::printf("\n");
+
+   /* access times that are compensated by the growth of the
+      reference access times, i.e. that reflect just TLB effects */
+   std::vector<std::vector<Sample>> compensated(backings.size());
+   double first_ref = 0;
+   for (std::size_t pages = MIN_PAGES; pages <= MAX_PAGES;
+	 pages += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(pages))-GRANULARITY))) {
+      fmt::printf(" %9u", pages);
+      void** memory = create_strided_chain(pages, LINE_SIZE,
+	 Backing::heap, SEED);
+      double ref = measure([=](std::size_t count) {
+	 return chase_pointers(memory, count);
+      }, measurement_parameters()).median;
+      free_buffer(memory, pages * LINE_SIZE, Backing::heap);
+      if (pages == MIN_PAGES) first_ref = ref;
+      fmt::printf("  %10.5lf", ref); std::cout.flush();
+
+      for (std::size_t i = 0; i < backings.size(); ++i) {
+	 Backing backing = backings[i];
+	 std::size_t page_size = backing_page_size(backing);
+	 memory = pages * page_size <= MAX_MEMORY?
+	    create_page_chain(pages, page_size, LINE_SIZE, backing, SEED):
+	    nullptr;
+	 if (!memory) {
+	    fmt::printf("  %10s  %10s  %10s  %10s", "-", "-", "-", "-");
+	    std::cout.flush();
+	    continue;
+	 }
+	 auto stats = measure([=](std::size_t count) {
+	    return chase_pointers(memory, count);
+	 }, measurement_parameters());
+	 free_buffer(memory, pages * page_size, backing);
+	 fmt::printf("  %10.5lf  %10.5lf  %10.5lf  %10.5lf",
+	    stats.median, stats.min, stats.stddev, stats.median - ref);
+	 std::cout.flush();
+	 compensated[i].push_back(Sample{pages,
+	    stats.median - (ref - first_ref)});
+      }
+      fmt::printf("\n");
+   }
+
+   /* the first plateau of the compensated access times ends at the
+      reach of the first level TLB, a second plateau, if any, before
+      the last one at the reach of the second level TLB; the last
+      plateau is the one of the page walks */
+   fmt::printf("\n  backing  dTLB pages  dTLB reach  STLB pages  STLB reach"
+      "  page walk in ns\n");
+   for (std::size_t i = 0; i < backings.size(); ++i) {
+      std::size_t page_size = backing_page_size(backings[i]);
+      auto levels = detect_levels(compensated[i],
+	 TOLERANCE, MIN_SPAN, MIN_STEP);
+      fmt::printf(" %8s", backing_name(backings[i]));
+      if (levels.size() < 2) {
+	 fmt::printf("  %10s  %10s  %10s  %10s  %15s\n",
+	    "-", "-", "-", "-", "-");
+	 continue;
+      }
+      fmt::printf("  %10u  %10u", levels[0].last, levels[0].last * page_size);
+      if (levels.size() > 2) {
+	 fmt::printf("  %10u  %10u", levels[1].last, levels[1].last * page_size);
+      } else {
+	 fmt::printf("  %10s  %10s", "-", "-");
+      }
+      fmt::printf("  %15.5lf\n", levels.back().ns - levels[0].ns);
+   }
+}
@@ -1,5 +1,5 @@
 /* 
-   Copyright (c) 2016 Andreas F. Borchert
+   Copyright (c) 2016, 2026 Andreas F. Borchert
    All rights reserved.
 
    Permission is hereby granted, free of charge, to any person obtaining
@@ -26,20 +26,74 @@
 #ifndef UNIFORM_INT_DISTRIBUTION_HPP
 #define UNIFORM_INT_DISTRIBUTION_HPP
 
+#include <cstdint>
 #include <random>
 
+/* splitmix64 by Sebastiano Vigna, used to expand seeds
+   and as mixing function */
+inline std::uint64_t splitmix64(std::uint64_t& state) {
+   std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+   return z ^ (z >> 31);
+}
+
+/* xoshiro256** by David Blackman and Sebastiano Vigna,
+   a fast generator which is good enough for our purposes */
+class Xoshiro256 {
+   public:
+      Xoshiro256(std::uint64_t seed) {
+	 for (auto& word: state) {
+	    word = splitmix64(seed);
+	 }
+      }
+      std::uint64_t operator()() {
+	 std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+	 std::uint64_t t = state[1] << 17;
+	 state[2] ^= state[0]; state[3] ^= state[1];
+	 state[1] ^= state[2]; state[0] ^= state[3];
+	 state[2] ^= t;
+	 state[3] = rotl(state[3], 45);
+	 return result;
+      }
+   private:
+      std::uint64_t state[4];
+      static std::uint64_t rotl(std::uint64_t x, int k) {
+	 return (x << k) | (x >> (64 - k));
+      }
+};
+
 /* simple class for a pseudo-random generator producing
-   uniformely distributed integers */
+   uniformely distributed integers;
+   if no seed or a seed of 0 is given, a random seed is taken */
 class UniformIntDistribution {
    public:
-      UniformIntDistribution() : engine(std::random_device()()) {}
+      UniformIntDistribution(std::uint64_t seed = 0) :
+	 engine(seed? seed: random_seed()) {
+      }
       /* return number in the range of [0..upper_limit) */
-      unsigned int draw(unsigned int upper_limit) {
-	 return std::uniform_int_distribution<unsigned int>
-	    (0, upper_limit-1)(engine);
+      std::uint64_t draw(std::uint64_t upper_limit) {
+	 /* multiply-and-shift with rejection, see
+	    Daniel Lemire: Fast Random Integer Generation in an Interval,
+	    ACM Transactions on Modeling and Computer Simulation, 2019;
+	    the full 128-bit product supports limits beyond 2^32 */
+	 unsigned __int128 m = (unsigned __int128) engine() * upper_limit;
+	 std::uint64_t low = static_cast<std::uint64_t>(m);
+	 if (low < upper_limit) {
+	    std::uint64_t threshold = -upper_limit % upper_limit;
+	    while (low < threshold) {
+	       m = (unsigned __int128) engine() * upper_limit;
+	       low = static_cast<std::uint64_t>(m);
+	    }
+	 }
+	 return static_cast<std::uint64_t>(m >> 64);
       }
    private:
-      std::mt19937 engine;
+      Xoshiro256 engine;
+      static std::uint64_t random_seed() {
+	 std::random_device device;
+	 return (std::uint64_t{device()} << 32) | device();
+      }
 };
 
 #endif
@@ -0,0 +1,71 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef UNROLLED_LOOP_HPP
+#define UNROLLED_LOOP_HPP
+
+#include <cstddef>
+#include <utility>
+#include "walltime.hpp"
+
+/* maximal unroll factor of the chasing loops which are unrolled
+   by powers of two; at L1 sizes, the decrement and the branch of
+   the loop would otherwise add to each load */
+constexpr std::size_t max_unroll = 32;
+
+/* run body sizeof...(I) times in straight-line code */
+template<typename Body, std::size_t... I>
+inline void repeat(Body& body, std::index_sequence<I...>) {
+   using expander = int[];
+   (void) expander{0, ((void) I, body(), 0)...};
+}
+
+/* run body count times in a loop that is unrolled by Unroll */
+template<std::size_t Unroll, typename Body>
+inline void unrolled_loop(std::size_t count, Body body) {
+   std::size_t rounds = count / Unroll;
+   while (rounds-- > 0) {
+      repeat(body, std::make_index_sequence<Unroll>());
+   }
+   for (std::size_t rest = count % Unroll; rest > 0; --rest) {
+      body();
+   }
+}
+
+/* run the unrolled loop count times where the body does nothing
+   but passing a pointer through a register, and return the real
+   time used in seconds; this is the overhead of the loop that
+   remains after unrolling */
+template<std::size_t Unroll>
+inline double empty_loop(std::size_t count) {
+   void* p = nullptr;
+   WallTime<double> walltime;
+   unrolled_loop<Unroll>(count, [&]() {
+      asm volatile("" : "+r"(p));
+   });
+   return walltime.elapsed();
+}
+
+#endif
@@ -0,0 +1,106 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef UTILITY_CONFIG_HPP
+#define UTILITY_CONFIG_HPP
+
+/* configuration of the utilities through the preprocessor macros
+   that are shared by most of them; this header is to be included by
+   the utilities only but not by the library which takes its defaults
+   from namespace chase_defaults instead */
+
+#include <cstddef>
+#include "measurement.hpp"
+#include "unrolled-loop.hpp"
+
+/* minimal duration of one sample in seconds */
+#ifndef SAMPLE_TIME
+#define SAMPLE_TIME 0.01
+#endif
+/* number of samples that are dropped before the measurement */
+#ifndef WARMUPS
+#define WARMUPS 2
+#endif
+#ifndef MIN_SAMPLES
+#define MIN_SAMPLES 5
+#endif
+#ifndef MAX_SAMPLES
+#define MAX_SAMPLES 200
+#endif
+/* target for the half width of the 95% confidence interval
+   of the mean relative to the mean */
+#ifndef CONFIDENCE
+#define CONFIDENCE 0.005
+#endif
+/* time budget for one measurement in seconds */
+#ifndef TIME_BUDGET
+#define TIME_BUDGET 2.0
+#endif
+/* samples that deviate by more than this factor times the
+   normalized median absolute deviation from the median
+   are rejected as outliers */
+#ifndef OUTLIER_FACTOR
+#define OUTLIER_FACTOR 3.0
+#endif
+
+/* seed for the random chains, 0 selects a random seed */
+#ifndef SEED
+#define SEED 0
+#endif
+/* number of threads that construct a random chain,
+   0 selects one thread per hardware thread */
+#ifndef CHAIN_THREADS
+#define CHAIN_THREADS 1
+#endif
+
+/* if LOCK_MEMORY is non-zero, arenas are locked into memory;
+   this may require to raise RLIMIT_MEMLOCK (ulimit -l) */
+#ifndef LOCK_MEMORY
+#define LOCK_MEMORY 0
+#endif
+
+/* unroll factor of the chasing loops, a power of two up to
+   max_unroll */
+#ifndef UNROLL
+#define UNROLL 8
+#endif
+static_assert(UNROLL >= 1 && UNROLL <= max_unroll &&
+   (UNROLL & (UNROLL - 1)) == 0,
+   "UNROLL must be a power of two up to max_unroll");
+
+/* parameters of the measurement harness as configured above */
+inline MeasurementParameters measurement_parameters() {
+   MeasurementParameters params;
+   params.sample_time = SAMPLE_TIME;
+   params.warmups = WARMUPS;
+   params.min_samples = MIN_SAMPLES;
+   params.max_samples = MAX_SAMPLES;
+   params.confidence = CONFIDENCE;
+   params.time_budget = TIME_BUDGET;
+   params.outlier_factor = OUTLIER_FACTOR;
+   return params;
+}
+
+#endif
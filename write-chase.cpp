@@ -0,0 +1,154 @@
+/* 
+   Copyright (c) 2026 Andreas F. Borchert
+   All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+   KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+   WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+/* variant of random-chase where each visited pointer is also
+   written back such that the visited cache lines become dirty
+   and have to be written back when they are evicted;
+   for each chase mode besides the first one, its extra cost
+   in comparison to the first mode is given */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <printf.hpp> /* see https://github.com/afborchert/fmt */
+#include "chase-pointers.hpp"
+#include "linear-chain.hpp"
+#include "measurement.hpp"
+#include "perf-counters.hpp"
+#include "random-chain.hpp"
+#include "utility-config.hpp"
+
+unsigned int log2(std::size_t val) {
+   unsigned int count = 0;
+   while (val >>= 1) {
+      ++count;
+   }
+   return count;
+}
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1024
+#endif
+#ifndef MAX_SIZE
+#define MAX_SIZE (std::size_t{128}<<20)
+#endif
+#ifndef GRANULARITY
+#define GRANULARITY (1u)
+#endif
+/* list of chase modes, see chase-pointers.hpp for the supported names */
+#ifndef MODES
+#define MODES "read store atomic nt"
+#endif
+/* if STRIDE is non-zero, linear chains with this stride are
+   chased instead of randomized chains */
+#ifndef STRIDE
+#define STRIDE 0
+#endif
+/* if PERF_COUNTERS is defined, hardware performance counters
+   per access are given for each measurement where available */
+
+int main() {
+   std::vector<ChaseMode> modes;
+   if (!parse_chase_modes(MODES, modes) || modes.empty()) {
+      std::cerr << "invalid list of chase modes: " << MODES << std::endl;
+      std::exit(1);
+   }
+
+   std::unique_ptr<PerfCounters> counters;
+#ifdef PERF_COUNTERS
+   counters.reset(new PerfCounters());
+   if (!counters->available()) {
+      std::cerr << "performance counters are not available" << std::endl;
+      counters.reset();
+   }
+#endif
+   std::size_t nof_counters = counters? counters->size(): 0;
+
+   fmt::printf("              ");
+   for (auto mode: modes) {
+      std::string name = chase_mode_name(mode);
+      std::size_t width = 36 + 12 * nof_counters;
+      fmt::printf("%s%s", std::string(width - name.size(), ' '), name);
+   }
+   fmt::printf("\n       memsize");
+   for (std::size_t i = 0; i < modes.size(); ++i) {
+      fmt::printf("      median         min      stddev");
+      for (std::size_t j = 0; j < nof_counters; ++j) {
+	 fmt::printf("  %10s", counters->name(j));
+      }
+   }
+   for (std::size_t i = 1; i < modes.size(); ++i) {
+      fmt::printf("  %10s", "+" + std::string(chase_mode_name(modes[i])));
+   }
+   fmt::printf("\n");
+   for (std::size_t memsize = MIN_SIZE; memsize <= MAX_SIZE;
+	 memsize += (std::size_t{1} <<
+	    (std::max(GRANULARITY, log2(memsize))-GRANULARITY))) {
+      fmt::printf(" %13u", memsize);
+      void** memory = STRIDE?
+	 create_linear_chain(memsize, STRIDE):
+	 create_random_chain(memsize, SEED, CHAIN_THREADS);
+      std::vector<double> medians;
+      for (auto mode: modes) {
+	 if (!chase_mode_supported(mode)) {
+	    fmt::printf("  %10s  %10s  %10s", "-", "-", "-");
+	    for (std::size_t j = 0; j < nof_counters; ++j) {
+	       fmt::printf("  %10s", "-");
+	    }
+	    std::cout.flush();
+	    medians.push_back(-1); continue;
+	 }
+	 if (counters) counters->reset();
+	 std::size_t accesses = 0;
+	 auto stats = measure([=, &counters, &accesses](std::size_t count) {
+	    accesses += count;
+	    return chase_pointers(memory, count, counters.get(), mode);
+	 }, measurement_parameters());
+	 medians.push_back(stats.median);
+	 fmt::printf("  %10.5lf  %10.5lf  %10.5lf",
+	    stats.median, stats.min, stats.stddev);
+	 for (std::size_t j = 0; j < nof_counters; ++j) {
+	    if (counters->scheduled()) {
+	       fmt::printf("  %10.5lf", counters->value(j) / accesses);
+	    } else {
+	       fmt::printf("  %10s", "-");
+	    }
+	 }
+	 std::cout.flush();
+      }
+      delete[] memory;
+      for (std::size_t i = 1; i < modes.size(); ++i) {
+	 if (medians[0] >= 0 && medians[i] >= 0) {
+	    fmt::printf("  %10.5lf", medians[i] - medians[0]);
+	 } else {
+	    fmt::printf("  %10s", "-");
+	 }
+      }
+      fmt::printf("\n"); std::cout.flush();
+   }
+}